@@ -1,11 +1,11 @@
 #version 450 core
 
 layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec4 aColor;
 
 out vec4 OutColor;
 
 uniform mat4 model;
+uniform vec4 color;
 uniform mat4 viewProj;
 
 uniform bool shake;
@@ -13,7 +13,7 @@ uniform float time;
 
 void main()
 {
-    OutColor = aColor;
+    OutColor = color;
 
     gl_Position = viewProj * model * vec4(aPos, 1.0f);
     if (shake) {
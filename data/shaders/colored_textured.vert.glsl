@@ -1,27 +1,29 @@
 #version 450 core
 
 layout(location = 0) in vec3 aPos;
-layout(location = 1) in vec4 aColor;
 layout(location = 2) in vec2 aTexCoord;
 
 out vec4 OutColor;
 out vec2 TexCoord;
 
 uniform mat4 model;
+uniform vec4 color;
 uniform mat4 viewProj;
 
 uniform bool shake;
 uniform float time;
 
 uniform bool mirrored;
+uniform vec4 clip; // note : x, y, width, height of the frame in the texture
 
 void main()
 {
-    OutColor = aColor;
+    OutColor = color;
+    vec2 coord = clip.xy + aTexCoord * clip.zw;
     if (mirrored)
-        TexCoord = vec2(-aTexCoord.x , aTexCoord.y);
+        TexCoord = vec2(-coord.x , coord.y);
     else
-        TexCoord = vec2(aTexCoord.x , aTexCoord.y);
+        TexCoord = vec2(coord.x , coord.y);
 
     gl_Position = viewProj * model * vec4(aPos, 1.0f);
     if (shake) {
@@ -0,0 +1,23 @@
+#version 450 core
+
+layout (location = 0) in vec2 aPos;
+layout (location = 4) in vec4 aColor;
+
+out vec4 OutColor;
+
+uniform mat4 viewProj;
+
+uniform bool shake;
+uniform float time;
+
+void main()
+{
+    OutColor = aColor;
+
+    gl_Position = viewProj * vec4(aPos, 0.0f, 1.0f);
+    if (shake) {
+        float strength = 0.01;
+        gl_Position.x += cos(time / 1000 * 10) * strength;
+        gl_Position.y += cos(time / 1000 * 15) * strength;
+    }
+}
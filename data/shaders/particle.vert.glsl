@@ -0,0 +1,24 @@
+#version 450 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 3) in vec4 aInstance; // x, y, z, size
+layout (location = 4) in vec4 aColor;
+
+out vec4 OutColor;
+
+uniform mat4 viewProj;
+
+uniform bool shake;
+uniform float time;
+
+void main()
+{
+    OutColor = aColor;
+
+    gl_Position = viewProj * vec4(aPos.xy * aInstance.w + aInstance.xy, aPos.z + aInstance.z, 1.0f);
+    if (shake) {
+        float strength = 0.01;
+        gl_Position.x += cos(time / 1000 * 10) * strength;
+        gl_Position.y += cos(time / 1000 * 15) * strength;
+    }
+}
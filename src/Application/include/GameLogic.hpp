@@ -53,7 +53,9 @@ public: // signals
     entt::sigh<void(entt::registry &, entt::entity, const glm::dvec2 &, Spell &)> onSpellCast;
     entt::sigh<void(entt::registry &, entt::entity receiver, entt::entity sender, entt::entity spell)> onCollideWithSpell;
 
-    entt::sigh<void(entt::registry &, entt::entity receiver, entt::entity sender, entt::entity spell)> onDamageTaken;
+    // note : spell is entt::null when the damage comes from a status effect
+    entt::sigh<void(entt::registry &, entt::entity receiver, entt::entity sender, entt::entity spell, float damage)>
+        onDamageTaken;
 
     entt::sigh<void(entt::registry &, entt::entity killed, entt::entity killer)> onEntityKilled;
 
@@ -81,7 +83,6 @@ private: // slots
     auto slots_update_player_movement(entt::registry &, const engine::TimeElapsed &) -> void;
     auto slots_update_ai_movement(entt::registry &, const engine::TimeElapsed &) -> void;
     auto slots_update_ai_attack(entt::registry &, const engine::TimeElapsed &) -> void;
-    auto slots_update_particle(entt::registry &, const engine::TimeElapsed &) -> void;
     // note : should be in Core
     auto slots_update_cooldown(entt::registry &, const engine::TimeElapsed &) -> void;
     auto slots_check_collision(entt::registry &, const engine::TimeElapsed &) -> void;
@@ -102,7 +103,8 @@ private: // slots
     auto slots_collide_with_spell(entt::registry &, entt::entity receiver, entt::entity sender, entt::entity spell) -> void;
 
     decltype(onDamageTaken)::sink_type sinkDamageTaken{onDamageTaken};
-    auto slots_damage_taken(entt::registry &, entt::entity receiver, entt::entity sender, entt::entity spell) -> void;
+    auto slots_damage_taken(
+        entt::registry &, entt::entity receiver, entt::entity sender, entt::entity spell, float damage) -> void;
 
     decltype(onEntityKilled)::sink_type sinkGetKilled{onEntityKilled};
     auto slots_kill_entity(entt::registry &, entt::entity killed, entt::entity killer) -> void;
@@ -7,6 +7,7 @@
 #include <Engine/Graphics/Shader.hpp>
 #include <Engine/Camera.hpp>
 #include <Engine/audio/Sound.hpp>
+#include <Engine/audio/MusicStream.hpp>
 
 #include "menu/AMenu.hpp"
 
@@ -53,7 +54,7 @@ public:
     auto getCamera() -> engine::Camera & { return m_camera; }
     void setMenu(std::unique_ptr<AMenu> &&menu) { m_currentMenu = std::move(menu);}
 
-    auto getBackgroundMusic() -> std::shared_ptr<engine::Sound> { return m_background_music; }
+    auto getBackgroundMusic() -> std::shared_ptr<engine::MusicStream> { return m_background_music; }
     void setBackgroundMusic(const std::string &path, float volume = 1) noexcept;
 
     entt::entity player; // note : remove me
@@ -72,7 +73,7 @@ private:
     EffectDatabase m_db_effects;
 
     engine::Camera m_camera; // note : should be in engine::Core
-    std::shared_ptr<engine::Sound> m_background_music;
+    std::shared_ptr<engine::MusicStream> m_background_music;
 
     std::unique_ptr<AMenu> m_currentMenu{ nullptr };
 };
@@ -6,7 +6,7 @@
 namespace game {
 
 struct Classes { // todo : name very confusing
-    std::vector<std::string> ids;
+    std::vector<ClassId> ids;
 };
 
 } // namespace game
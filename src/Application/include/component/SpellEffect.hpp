@@ -1,13 +1,14 @@
 #pragma once
 
 #include <vector>
-#include <string>
+
+#include "models/Effect.hpp"
 
 namespace game {
 
 struct SpellEffect {
 
-    std::vector<std::string> ref;
+    std::vector<EffectId> ref;
 
 };
 
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+#include <entt/entt.hpp>
+
+#include <Engine/component/Cooldown.hpp>
+
+#include "models/Effect.hpp"
+
+namespace game {
+
+// note : the effects applied to an entity, kept inline so applying or ticking them only touches this entity
+struct StatusEffects {
+    static constexpr std::size_t CAPACITY = 8;
+
+    // note : not in the database, the short flash of an entity being hit
+    static constexpr EffectId HIT = Database<Effect>::npos;
+
+    struct Active {
+        EffectId id;
+        Effect::Type type;
+        float damage;
+
+        entt::entity sender;
+
+        std::chrono::milliseconds lifetime;
+        engine::Cooldown cd;
+    };
+
+    std::array<Active, CAPACITY> effects;
+    std::uint8_t count{0};
+
+    [[nodiscard]] auto find(EffectId id) noexcept -> Active *
+    {
+        for (auto i = 0ul; i != count; i++) {
+            if (effects[i].id == id) return &effects[i];
+        }
+        return nullptr;
+    }
+
+    // note : nullptr if the entity already has CAPACITY effects
+    auto add(const Active &effect) noexcept -> Active *
+    {
+        if (count == CAPACITY) return nullptr;
+        effects[count] = effect;
+        return &effects[count++];
+    }
+
+    // note : the last effect takes its place
+    auto remove(std::size_t index) noexcept -> void { effects[index] = effects[--count]; }
+};
+
+} // namespace game
@@ -8,7 +8,7 @@
 #include <Engine/component/Rotation.hpp>
 #include <Engine/component/Hitbox.hpp>
 #include <Engine/component/Source.hpp>
-#include <Engine/component/Spritesheet.hpp>
+#include <Engine/component/AnimationState.hpp>
 #include <Engine/component/Lifetime.hpp>
 #include <Engine/component/Copy.hpp>
 
@@ -18,6 +18,7 @@
 #include "component/AttackDamage.hpp"
 #include "component/SpellEffect.hpp"
 #include "component/SpellTarget.hpp"
+#include "component/StatusEffects.hpp"
 #include "component/Speed.hpp"
 #include "component/StatsTracking.hpp"
 
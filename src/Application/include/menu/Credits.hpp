@@ -2,6 +2,8 @@
 
 #include <entt/entt.hpp>
 
+#include <Engine/resources/ResourceId.hpp>
+
 #include "AMenu.hpp"
 
 namespace game::menu {
@@ -13,7 +15,7 @@ public:
     void event(entt::registry &world, ThePURGE &game, const engine::Event &e) final;
 
 private:
-    std::uint32_t m_texture;
+    engine::ResourceId m_texture;
 };
 
 } // namespace game
@@ -29,7 +29,7 @@ private:
         MAX // last value, not a real button
     };
 
-    std::uint32_t m_backgroundTexture;
+    engine::ResourceId m_backgroundTexture;
     std::vector<GUITexture> m_buttons;
 
     int m_selected = Button::PLAY_AGAIN;
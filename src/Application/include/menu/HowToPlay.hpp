@@ -2,6 +2,8 @@
 
 #include <entt/entt.hpp>
 
+#include <Engine/resources/ResourceId.hpp>
+
 #include "AMenu.hpp"
 
 namespace game::menu {
@@ -18,8 +20,8 @@ private:
         CONTROLS
     };
 
-    std::uint32_t m_howToPlay;
-    std::uint32_t m_controls;
+    engine::ResourceId m_howToPlay;
+    engine::ResourceId m_controls;
 
     Tab m_currentTab = Tab::HOW_TO_PLAY;
 };
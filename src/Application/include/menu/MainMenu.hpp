@@ -24,7 +24,7 @@ private:
     };
 
 
-    std::uint32_t m_backgroundTexture;
+    engine::ResourceId m_backgroundTexture;
     std::vector<GUITexture> m_buttons;
 
     int m_selected = Button::PLAY;
@@ -7,16 +7,21 @@
 #include <utility>
 
 #include <Engine/component/Hitbox.hpp>
+#include <Engine/resources/ResourceId.hpp>
 
 #include "factory/SpellFactory.hpp"
 #include "factory/EntityFactory.hpp"
+#include "models/Database.hpp"
+#include "models/Spell.hpp"
 
 namespace game {
 
+using ClassId = DatabaseId;
+
 struct Class { // todo : name very confusing
     std::string name;
-    std::string iconPath;
-    std::string assetGraphPath;
+    engine::ResourceId iconPath; // note : interned when the database is loaded
+    engine::ResourceId assetGraphPath;
 
     bool is_starter = false;
     int cost;
@@ -25,18 +30,19 @@ struct Class { // todo : name very confusing
     float speed;
     engine::d2::HitboxSolid hitbox;
 
-    std::vector<std::string> spells;
-    std::vector<std::string> children;
+    std::vector<SpellId> spells;
+    std::vector<ClassId> children;
 };
 
 struct ClassDatabase {
-    std::vector<Class> db;
+    Database<Class> db;
 
-    auto fromFile(const std::string_view path) -> ClassDatabase &;
+    // note : the spells must be loaded first
+    auto fromFile(const std::string_view path, const SpellDatabase &spells) -> ClassDatabase &;
 
-    auto getByName(const std::string_view name) -> const Class *;
+    auto getByName(const std::string_view name) const -> const Class *;
 
-    auto getStarterClass() -> const Class &;
+    auto getStarterClass() const -> const Class &;
 };
 
 } // namespace game
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <entt/entt.hpp>
+#include <spdlog/spdlog.h>
+
+namespace game {
+
+// note : every database share the same id type, the entries can be declared before being defined
+using DatabaseId = std::uint16_t;
+
+// note : the entries of a json database compiled in a dense array, the id of an entry is its index
+//        the names are resolved once at load time, the game only handles the ids afterward
+template<typename T>
+class Database {
+public:
+    using Id = DatabaseId;
+
+    static constexpr Id npos = std::numeric_limits<Id>::max();
+
+    auto emplace(const std::string_view name, T &&value) -> Id
+    {
+        const auto id = static_cast<Id>(m_entries.size());
+        const auto hash = entt::hashed_string::value(name.data(), name.size());
+        if (const auto [it, inserted] = m_index.try_emplace(hash, id); !inserted) {
+            spdlog::error("Database: '{}' collides with '{}', it can not be found by name", name, m_names[it->second]);
+        }
+        m_entries.push_back(std::move(value));
+        m_names.emplace_back(name);
+        return id;
+    }
+
+    // note : npos if there is no such entry
+    [[nodiscard]] auto find(const std::string_view name) const noexcept -> Id
+    {
+        const auto found = m_index.find(entt::hashed_string::value(name.data(), name.size()));
+        if (found == m_index.end() || m_names[found->second] != name) return npos;
+        return found->second;
+    }
+
+    // note : the id of an entry given by reference
+    [[nodiscard]] auto id(const T &entry) const noexcept -> Id { return static_cast<Id>(&entry - m_entries.data()); }
+
+    [[nodiscard]] auto name(Id id) const noexcept -> const std::string & { return m_names[id]; }
+
+    [[nodiscard]] auto operator[](Id id) noexcept -> T & { return m_entries[id]; }
+
+    [[nodiscard]] auto operator[](Id id) const noexcept -> const T & { return m_entries[id]; }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_entries.size(); }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return m_entries.empty(); }
+
+    auto begin() noexcept { return m_entries.begin(); }
+    auto end() noexcept { return m_entries.end(); }
+    auto begin() const noexcept { return m_entries.begin(); }
+    auto end() const noexcept { return m_entries.end(); }
+
+private:
+    std::vector<T> m_entries;
+    std::vector<std::string> m_names;
+    std::unordered_map<entt::id_type, Id> m_index;
+};
+
+// note : resolve a list of names, the unknown ones are reported and dropped
+template<typename T>
+auto resolve(const Database<T> &db, const std::vector<std::string> &names, const std::string_view from)
+    -> std::vector<typename Database<T>::Id>
+{
+    std::vector<typename Database<T>::Id> out;
+    out.reserve(names.size());
+    for (const auto &name : names) {
+        if (const auto id = db.find(name); id != Database<T>::npos) {
+            out.push_back(id);
+        } else {
+            spdlog::warn("'{}' refers to the unknown '{}'. Ignoring", from, name);
+        }
+    }
+    return out;
+}
+
+} // namespace game
@@ -6,6 +6,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include "models/Database.hpp"
 #include "models/utils.hpp"
 
 namespace game {
@@ -20,11 +21,11 @@ struct Effect {
 
     Type type;
 
-    float damage;
+    float damage{0.0f};
     std::chrono::milliseconds lifetime;
     std::chrono::milliseconds cooldown;
 
-    float strength;
+    float strength{1.0f};
 };
 
 inline void to_json([[maybe_unused]] nlohmann::json &j, [[maybe_unused]] const Effect &effect) {}
@@ -43,8 +44,10 @@ inline void from_json(const nlohmann::json &j, Effect &effect)
     }
 }
 
+using EffectId = DatabaseId;
+
 struct EffectDatabase {
-    std::unordered_map<std::string, Effect> db;
+    Database<Effect> db;
 
     auto fromFile(const std::string_view path) -> bool;
 };
@@ -11,12 +11,16 @@
 
 #include <Engine/component/Hitbox.hpp>
 #include <Engine/component/Scale.hpp>
+#include <Engine/resources/ResourceId.hpp>
+
+#include "models/Database.hpp"
+#include "models/Spell.hpp"
 
 namespace game {
 
 struct Enemy {
 
-    std::string asset;
+    engine::ResourceId asset; // note : interned when the database is loaded
 
     float health;
     float speed;
@@ -27,7 +31,7 @@ struct Enemy {
 
     engine::d2::Scale scale;
 
-    std::vector<std::string> spells;
+    std::vector<SpellId> spells;
 
     bool is_boss;
 
@@ -52,7 +56,7 @@ inline void to_json([[maybe_unused]] nlohmann::json &j, [[maybe_unused]] const E
 inline void from_json(const nlohmann::json &j, Enemy &enemy)
 {
 
-    enemy.asset = j.at("asset");
+    enemy.asset = engine::ResourceId::intern(j.at("asset").get<std::string>());
     enemy.health = j.at("health");
     enemy.speed = j.at("speed");
     enemy.color.r = j.at("color").at("r");
@@ -63,7 +67,7 @@ inline void from_json(const nlohmann::json &j, Enemy &enemy)
     enemy.hitbox.height = j.at("hitbox").at("y");
     enemy.scale.x = j.at("scale").at("x");
     enemy.scale.y = j.at("scale").at("y");
-    enemy.spells = j.at("spells").get<std::vector<std::string>>();
+    // note : the spells are resolved by EnemyDatabase::fromFile
     enemy.is_boss = j.value("is_boss", false);
     enemy.view_range = j.at("view_range");
     enemy.attack_range = j.at("attack_range");
@@ -71,10 +75,13 @@ inline void from_json(const nlohmann::json &j, Enemy &enemy)
     enemy.tag = j.value("tag", std::vector<std::string>{});
 }
 
+using EnemyId = DatabaseId;
+
 struct EnemyDatabase {
-    std::unordered_map<std::string, Enemy> db;
+    Database<Enemy> db;
 
-    auto fromFile(const std::string_view path) -> bool;
+    // note : the spells must be loaded first
+    auto fromFile(const std::string_view path, const SpellDatabase &spells) -> bool;
 };
 
 } // namespace game
@@ -12,15 +12,20 @@
 #include <Engine/component/Cooldown.hpp>
 #include <Engine/component/Hitbox.hpp>
 #include <Engine/component/Scale.hpp>
+#include <Engine/resources/ResourceId.hpp>
 
 #include "factory/SpellFactory.hpp"
+#include "models/Database.hpp"
+#include "models/Effect.hpp"
 
 using namespace std::chrono_literals;
 
 namespace game {
 
+using SpellId = DatabaseId;
+
 struct /*[[deprecated]]*/ Spell {
-    std::string_view id;
+    SpellId id;
 
     engine::Cooldown cd;
 };
@@ -28,7 +33,7 @@ struct /*[[deprecated]]*/ Spell {
 struct SpellData {
     std::string name;
     std::string description;
-    std::string iconPath;
+    engine::ResourceId iconPath; // note : interned when the database is loaded
 
     std::chrono::milliseconds cooldown;
 
@@ -37,8 +42,8 @@ struct SpellData {
     double speed;
 
     std::chrono::milliseconds lifetime;
-    std::string audio_on_cast;
-    std::string animation;
+    engine::ResourceId audio_on_cast;
+    engine::ResourceId animation;
     engine::d2::Scale scale;
 
     double offset_to_source_x;
@@ -57,7 +62,7 @@ struct SpellData {
 
     std::bitset<Type::TYPE_MAX> type;
 
-    std::vector<std::string> effects;
+    std::vector<EffectId> effects;
 
 
     enum Target : std::uint8_t {
@@ -75,7 +80,7 @@ struct SpellData {
     int quantity;
     double angle;
 
-    std::string on_death;
+    SpellId on_death;
 
 };
 
@@ -83,11 +88,12 @@ void to_json(nlohmann::json &j, const SpellData &spell);
 void from_json(const nlohmann::json &j, SpellData &spell);
 
 struct SpellDatabase {
-    std::unordered_map<std::string, SpellData> db;
+    Database<SpellData> db;
 
-    auto fromFile(const std::string_view) -> bool;
+    // note : the effects must be loaded first
+    auto fromFile(const std::string_view, const EffectDatabase &) -> bool;
 
-    [[nodiscard]] auto instantiate(const std::string_view) -> std::optional<Spell>;
+    [[nodiscard]] auto instantiate(SpellId) const -> std::optional<Spell>;
 };
 
 } // namespace game
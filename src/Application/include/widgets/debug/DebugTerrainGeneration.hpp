@@ -52,7 +52,8 @@ struct TerrainGeneration {
             50);
         ImGui::Separator();
 
-        for (const auto &[name, _] : game.dbEnemies().db) {
+        for (auto id = EnemyId{0}; id != game.dbEnemies().db.size(); id++) {
+            const auto &name = game.dbEnemies().db.name(id);
             ImGui::SliderFloat("Enemy '{}' per block", &game.logics()->m_map_generation_params.mobDensity[name], 0, 1);
         }
 
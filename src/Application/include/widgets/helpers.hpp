@@ -2,11 +2,15 @@
 
 #include <imgui.h>
 #include <cstdint>
+#include <string>
+
+#include <Engine/resources/ResourceId.hpp>
 
 namespace game {
 
+// note : the texture is looked up in the cache each time it is drawn, so it is never released while on screen
 struct GUITexture {
-    std::uint32_t id;
+    engine::ResourceId texture;
 
     // In a range [0; 1] relative to the window size
     ImVec2 topleft;
@@ -16,15 +20,17 @@ struct GUITexture {
 namespace helper {
 
 // path relative to the data directory
-auto getTexture(const std::string &simplePath) -> std::uint32_t;
+auto getTexture(const engine::ResourceId &simplePath) -> std::uint32_t;
 auto from1080p(float x, float y) noexcept -> ImVec2;
 
 auto frac2pixel(ImVec2 fraction) noexcept -> ImVec2;
 
 // topLeft and size in PIXELS
 void drawTexture(std::uint32_t id, ImVec2 topLeft, ImVec2 size, ImVec4 tintColor = ImVec4(1, 1, 1, 1)) noexcept;
+// note : the texture is looked up in the cache, a texture released over its budget is loaded again
+void drawTexture(const engine::ResourceId &texture, ImVec2 topLeft, ImVec2 size, ImVec4 tintColor = ImVec4(1, 1, 1, 1));
 
-void drawTexture(const GUITexture &t, ImVec4 tintColor = ImVec4(1, 1, 1, 1)) noexcept;
+void drawTexture(const GUITexture &t, ImVec4 tintColor = ImVec4(1, 1, 1, 1));
 
 void drawText(ImVec2 pos, const std::string &str, ImVec4 color = ImVec4(1, 1, 1, 1), ImFont *font = nullptr) noexcept;
 void drawTextWrapped(ImVec2 pos, const std::string &str, float maxX, ImFont *font = nullptr) noexcept;
@@ -8,6 +8,7 @@
 #include <Engine/component/Color.hpp>
 #include <Engine/component/VBOTexture.hpp>
 #include <Engine/helpers/DrawableFactory.hpp>
+#include <Engine/resources/AssetLoader.hpp>
 #include <Engine/Core.hpp>
 
 
@@ -43,7 +44,6 @@ game::GameLogic::GameLogic(ThePURGE &game) :
     sinkGameUpdated.connect<&GameLogic::slots_update_player_movement>(*this);
     sinkGameUpdated.connect<&GameLogic::slots_update_ai_movement>(*this);
     sinkGameUpdated.connect<&GameLogic::slots_update_ai_attack>(*this);
-    sinkGameUpdated.connect<&GameLogic::slots_update_particle>(*this);
     sinkGameUpdated.connect<&GameLogic::slots_update_cooldown>(*this);
     sinkGameUpdated.connect<&GameLogic::slots_update_effect>(*this);
     sinkGameUpdated.connect<&GameLogic::slots_check_collision>(*this);
@@ -80,12 +80,12 @@ auto game::GameLogic::slots_game_start(entt::registry &world) -> void
         world.emplace<engine::d2::Scale>(e, 75.0, 75.0);
         world.emplace<engine::Drawable>(e, engine::DrawableFactory::rectangle());
         engine::DrawableFactory::fix_color(world, e, {0.15, 0.15, 0.15, 1});
-        engine::DrawableFactory::fix_texture(world, e, holder.instance->settings().data_folder + "img/background.jpg", true);
+        engine::DrawableFactory::fix_texture(world, e, "img/background.jpg"_rid, true);
     }
 
     holder.instance->getAudioManager()
-        .getSound(holder.instance->settings().data_folder + "sounds/entrance_gong.wav")
-        ->setVolume(0.2f)
+        .getSound("sounds/entrance_gong.wav"_rid, engine::SoundPriority::HIGH)
+        .setVolume(0.2f)
         .play();
     m_game.setBackgroundMusic("sounds/dungeon_music.wav", 0.1f);
 
@@ -279,41 +279,6 @@ auto game::GameLogic::slots_update_cooldown(entt::registry &world, const engine:
     });
 }
 
-auto game::GameLogic::slots_update_particle(
-    [[maybe_unused]] entt::registry &world, [[maybe_unused]] const engine::TimeElapsed &dt) -> void
-{
-    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(dt.elapsed).count();
-    for (const auto &i : world.view<Particule>()) {
-        switch (world.get<Particule>(i).id) {
-        case Particule::HITMARKER: {
-            auto &color = world.get<engine::Color>(i);
-            const auto r = engine::Color::r(color);
-            const auto g = std::clamp(engine::Color::g(color) + 0.0001f * static_cast<float>(elapsed), 0.0f, 1.0f);
-            const auto b = std::clamp(engine::Color::b(color) + 0.0001f * static_cast<float>(elapsed), 0.0f, 1.0f);
-            const auto a = engine::Color::a(color);
-            engine::DrawableFactory::fix_color(world, i, {r, g, b, a});
-
-            auto &vel = world.get<engine::d2::Velocity>(i);
-            vel.x += ((std::rand() & 1) ? -1 : 1) * 0.005 * static_cast<double>(elapsed);
-            vel.y += ((std::rand() & 1) ? -1 : 1) * 0.005 * static_cast<double>(elapsed);
-        } break;
-        case Particule::POSITIVE: {
-            auto &color = world.get<engine::Color>(i);
-            const auto r = engine::Color::r(color);
-            const auto g = std::clamp(engine::Color::g(color) + 0.0001f * static_cast<float>(elapsed), 0.0f, 1.0f);
-            const auto b = std::clamp(engine::Color::b(color) + 0.0001f * static_cast<float>(elapsed), 0.0f, 1.0f);
-            const auto a = engine::Color::a(color);
-            engine::DrawableFactory::fix_color(world, i, {r, g, b, a});
-
-            auto &vel = world.get<engine::d2::Velocity>(i);
-            vel.x -= ((std::rand() & 1) ? -1 : 1) * 0.005 * static_cast<double>(elapsed);
-            vel.y -= ((std::rand() & 1) ? -1 : 1) * 0.005 * static_cast<double>(elapsed);
-        } break;
-        default: break;
-        }
-    }
-}
-
 auto game::GameLogic::slots_check_floor_change(entt::registry &world, const engine::TimeElapsed &) -> void
 {
     world.view<KeyPicker, engine::d3::Position>().each(
@@ -328,10 +293,10 @@ auto game::GameLogic::slots_check_floor_change(entt::registry &world, const engi
 
 auto game::GameLogic::slots_check_animation_attack_status(entt::registry &world, const engine::TimeElapsed &) -> void
 {
-    world.view<engine::Spritesheet>(entt::exclude<entt::tag<"spell"_hs>>).each([&](engine::Spritesheet &sprite) {
-        if (sprite.current_animation != "attack_left" && sprite.current_animation != "attack_right") return;
-        auto size = sprite.animations.at(sprite.current_animation).frames.size();
-        if (sprite.current_frame == (size - 1)) sprite.attack_animation_finish = true;
+    world.view<engine::AnimationState>(entt::exclude<entt::tag<"spell"_hs>>).each([&](engine::AnimationState &state) {
+        if (!state.is("attack_left") && !state.is("attack_right")) return;
+        auto size = state.current().frames.size();
+        if (state.frame == (size - 1)) state.attack_animation_finish = true;
     });
 }
 
@@ -349,12 +314,11 @@ auto game::GameLogic::slots_update_camera(entt::registry &world, const engine::T
 // this function will try to update the spritesheet ate everyframe !!! BAD BAD BAD
 auto game::GameLogic::slots_update_animation_spritesheet(entt::registry &world, const engine::TimeElapsed &) -> void
 {
-    for (const auto &i : world.view<engine::Spritesheet, engine::d2::Velocity>(entt::exclude<entt::tag<"spell"_hs>>)) {
+    for (const auto &i : world.view<engine::AnimationState, engine::d2::Velocity>(entt::exclude<entt::tag<"spell"_hs>>)) {
         const auto &vel = world.get<engine::d2::Velocity>(i);
-        const auto &sp = world.get<engine::Spritesheet>(i);
+        const auto &sp = world.get<engine::AnimationState>(i);
 
-        if ((world.has<engine::Spritesheet>(i) && sp.current_animation == "death") || sp.attack_animation_finish == false)
-            continue;
+        if (sp.is("death") || sp.attack_animation_finish == false) continue;
 
         const auto aiming = [](entt::registry &w, const entt::entity &e) -> std::optional<glm::vec2> {
             if (w.has<AimingDirection>(e)) {
@@ -378,9 +342,11 @@ auto game::GameLogic::slots_update_animation_spritesheet(entt::registry &world,
         const auto isMoving = vel.x || vel.y;
 
         // all the entity will be looking on the right by default because they don t have a AimingDirection BAD BAD BAD
-        const auto animation = fmt::format("{}_{}", isMoving ? "run" : "idle", isFacingLeft ? "left" : "right");
+        // note : no string is built for each entity at each frame
+        constexpr std::string_view animations[2][2] = {{"idle_right", "idle_left"}, {"run_right", "run_left"}};
+        const auto animation = animations[isMoving ? 1 : 0][isFacingLeft ? 1 : 0];
 
-        if (sp.current_animation != animation) { engine::DrawableFactory::fix_spritesheet(world, i, animation); }
+        if (!sp.is(animation)) { engine::DrawableFactory::fix_spritesheet(world, i, animation); }
     }
 }
 
@@ -415,6 +381,17 @@ auto game::GameLogic::slots_update_player_sigh(entt::registry &world, const engi
 
 auto game::GameLogic::slots_change_floor(entt::registry &world) -> void
 {
+    static auto holder = engine::Core::Holder{};
+
+    // note : decoded in the background while the floor is generated, so the first enemy or spell does not hitch
+    engine::AssetLoader::Manifest manifest;
+    for (const auto &enemy : m_game.dbEnemies().db) manifest.spritesheets.emplace_back(enemy.asset.path());
+    for (const auto &spell : m_game.dbSpells().db) {
+        manifest.spritesheets.emplace_back(spell.animation.path());
+        manifest.sounds.emplace_back(spell.audio_on_cast.path());
+    }
+    holder.instance->getAssetLoader().preload(manifest);
+
     Stage{}.clear(world, false);
 
     spdlog::info("Creating the terrain...");
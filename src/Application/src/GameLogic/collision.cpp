@@ -165,8 +165,8 @@ auto game::GameLogic::slots_check_collision(entt::registry &world, const engine:
                     pickerhitbox, pickerPos, world.get<engine::d2::HitboxFloat>(key), world.get<engine::d3::Position>(key))) {
                 picker.hasKey = true;
                 holder.instance->getAudioManager()
-                    .getSound(holder.instance->settings().data_folder + "sounds/key_pickup.wav")
-                    ->play();
+                    .getSound("sounds/key_pickup.wav"_rid, engine::SoundPriority::HIGH)
+                    .play();
                 world.destroy(key);
             }
         }
@@ -8,6 +8,7 @@
 #include <Engine/component/Color.hpp>
 #include <Engine/component/VBOTexture.hpp>
 #include <Engine/helpers/DrawableFactory.hpp>
+#include <Engine/resources/AssetLoader.hpp>
 #include <Engine/Core.hpp>
 
 
@@ -40,12 +41,13 @@ auto game::GameLogic::slots_apply_classes(entt::registry &world, entt::entity pl
     health.current += newClass.health;
     if (health.current <= 0) health.current = 1;
     health.max += newClass.health;
-    world.get<Classes>(player).ids.push_back(newClass.name);
+    world.get<Classes>(player).ids.push_back(m_game.dbClasses().db.id(newClass));
 
-    world.replace<engine::Spritesheet>(
-        player, engine::Spritesheet::from_json(holder.instance->settings().data_folder + newClass.assetGraphPath));
-
-    engine::DrawableFactory::fix_spritesheet(world, player, "idle_right");
+    engine::DrawableFactory::fix_spritesheet(
+        world,
+        player,
+        holder.instance->getAssetLoader().spritesheet(newClass.assetGraphPath),
+        "idle_right");
 
     world.get<SkillPoint>(player).count -= newClass.cost;
 }
@@ -64,7 +66,7 @@ auto game::GameLogic::slots_level_up(entt::registry &world, entt::entity entity)
     const auto &pos = world.get<engine::d3::Position>(entity);
     ParticuleFactory::create<Particule::POSITIVE>(world, {pos.x, pos.y}, {255.f, 255.f, 35.f});
 
-    holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/level_up.wav")->play();
+    holder.instance->getAudioManager().getSound("sounds/level_up.wav"_rid, engine::SoundPriority::HIGH).play();
 }
 
 auto game::GameLogic::addXp(entt::registry &world, entt::entity player, std::uint32_t xp) -> void
@@ -78,57 +80,65 @@ auto game::GameLogic::addXp(entt::registry &world, entt::entity player, std::uin
 
 auto game::GameLogic::slots_update_effect(entt::registry &world, const engine::TimeElapsed &dt) -> void
 {
-    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(dt.elapsed).count();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(dt.elapsed);
+
+    const auto restore = [&world](entt::entity receiver) {
+        const auto &initial_speed =
+            world.get_or_emplace<engine::Copy<Speed>>(receiver, world.get<Speed>(receiver)).data;
+        world.replace<Speed>(receiver, initial_speed);
+        world.remove_if_exists<engine::Copy<Speed>>(receiver);
+
+        const auto &initial_color =
+            world.get_or_emplace<engine::Copy<engine::Color>>(receiver, world.get<engine::Color>(receiver)).data;
+        engine::DrawableFactory::fix_color(
+            world,
+            receiver,
+            {engine::Color::r(initial_color),
+             engine::Color::g(initial_color),
+             engine::Color::b(initial_color),
+             engine::Color::a(initial_color)});
+        world.remove_if_exists<engine::Copy<engine::Color>>(receiver);
+    };
+
+    // note : the damages are dealt once every effect is ticked, a death must not modify the storage being iterated
+    struct Hit {
+        entt::entity receiver;
+        entt::entity sender;
+        float damage;
+    };
+    std::vector<Hit> hits;
+
+    for (const auto receiver : world.view<StatusEffects>()) {
+        auto &status = world.get<StatusEffects>(receiver);
+
+        for (auto i = 0ul; i < status.count;) {
+            auto &effect = status.effects[i];
+
+            if (effect.cd.is_in_cooldown && elapsed < effect.cd.remaining_cooldown) {
+                effect.cd.remaining_cooldown -= elapsed;
+            } else {
+                effect.cd.is_in_cooldown = true;
+                effect.cd.remaining_cooldown = effect.cd.cooldown;
 
-    world.view<entt::tag<"effect"_hs>, engine::Cooldown>().each([&elapsed](auto &, auto &cd) {
-        if (!cd.is_in_cooldown) return;
+                switch (effect.type) {
+                case Effect::Type::DOT: hits.push_back({receiver, effect.sender, effect.damage}); break;
+                case Effect::Type::DASH: restore(receiver); break;
+                default: break;
+                }
+            }
 
-        if (std::chrono::milliseconds{elapsed} <= cd.remaining_cooldown) {
-            cd.remaining_cooldown -= std::chrono::milliseconds{elapsed};
-        } else {
-            cd.remaining_cooldown = 0ms;
-            cd.is_in_cooldown = false;
-        }
-    });
-
-    for (const auto &effect : world.view<entt::tag<"effect"_hs>>()) {
-        auto &cd = world.get<engine::Cooldown>(effect);
-        if (cd.is_in_cooldown) continue;
-        cd.is_in_cooldown = true;
-        cd.remaining_cooldown = cd.cooldown;
-
-        const auto &receiver = world.get<engine::Source>(effect).source;
-        const auto &sender = world.get<engine::SourceBis>(effect).source;
-        if (!world.valid(receiver)) {
-            world.destroy(effect);
-            continue;
+            if (elapsed < effect.lifetime) {
+                effect.lifetime -= elapsed;
+                i++;
+            } else {
+                if (effect.type == Effect::Type::DASH) restore(receiver);
+                status.remove(i);
+            }
         }
+    }
 
-        switch (world.get<Effect::Type>(effect)) {
-        case Effect::Type::DOT: {
-            onDamageTaken.publish(world, receiver, sender, effect);
-            // world.destroy(effect);
-
-        } break;
-        case Effect::Type::DASH: {
-            const auto &initial_speed = world.get_or_emplace<engine::Copy<Speed>>(receiver, world.get<Speed>(receiver)).data;
-            world.replace<Speed>(receiver, initial_speed);
-            world.remove_if_exists<engine::Copy<Speed>>(receiver);
-
-            const auto &initial_color =
-                world.get_or_emplace<engine::Copy<engine::Color>>(receiver, world.get<engine::Color>(receiver)).data;
-            engine::DrawableFactory::fix_color(
-                world,
-                receiver,
-                {engine::Color::r(initial_color),
-                 engine::Color::g(initial_color),
-                 engine::Color::b(initial_color),
-                 engine::Color::a(initial_color)});
-            world.remove_if_exists<engine::Copy<engine::Color>>(receiver);
-
-        } break;
-        default: break;
-        }
+    for (const auto &[receiver, sender, damage] : hits) {
+        onDamageTaken.publish(world, receiver, sender, entt::entity{entt::null}, damage);
     }
 }
 
@@ -145,79 +155,62 @@ auto game::GameLogic::slots_collide_with_spell(
     const auto to_all = targets[SpellData::Target::ALL];
 
     if (to_the_caster || to_an_enemy || to_all) {
-        const auto effects = [&](const auto &ref) {
-            struct sPsE {
-                std::string_view tag;
-                const Effect *effect;
+        auto &status = world.get_or_emplace<StatusEffects>(receiver);
+
+        for (const auto id : world.get<SpellEffect>(spell).ref) {
+            const auto &effect = m_game.dbEffects().db[id];
+
+            if (auto found = status.find(id); found) {
+                found->lifetime = effect.lifetime;
+                continue;
+            }
+
+            spdlog::info("create effect");
+
+            const StatusEffects::Active active{
+                .id = id,
+                .type = effect.type,
+                .damage = effect.damage,
+                .sender = sender,
+                .lifetime = effect.lifetime,
+                .cd = {true, effect.cooldown, effect.cooldown},
             };
-            std::vector<sPsE> out;
-            std::transform(ref.begin(), ref.end(), std::back_inserter(out), [&](const auto &id) {
-                return sPsE{id, &m_game.dbEffects().db.at(id)};
-            });
-            return out;
-        }(world.get<SpellEffect>(spell).ref);
-
-        for (auto &[new_tag, i] : effects) {
-            const auto view = world.view<entt::tag<"effect"_hs>, engine::Source, std::string>();
-            const auto found = std::find_if(view.begin(), view.end(), [&world, &new_tag, &receiver](const auto &entity) {
-                const auto &source = world.get<engine::Source>(entity);
-                const auto &tag = world.get<std::string>(entity);
-                return tag == new_tag && source.source == receiver;
-            });
-
-            if (found != view.end()) {
-                world.emplace_or_replace<engine::Lifetime>(*found, i->lifetime);
+            if (!status.add(active)) {
+                spdlog::warn("Too many effects on the entity, '{}' is ignored", m_game.dbEffects().db.name(id));
+                continue;
+            }
 
-            } else {
-                spdlog::info("create effect");
-
-                auto new_effect = world.create();
-                world.emplace<entt::tag<"effect"_hs>>(new_effect);
-                world.emplace<engine::Source>(new_effect, receiver);
-                world.emplace<engine::SourceBis>(new_effect, sender);
-                world.emplace<engine::Lifetime>(new_effect, i->lifetime);
-                world.emplace<engine::Cooldown>(new_effect, true, i->cooldown, i->cooldown);
-                world.emplace<std::string>(new_effect, new_tag);
-
-                world.emplace<Effect::Type>(new_effect, i->type);
-
-                if (i->type == Effect::DOT) {
-                    world.emplace<AttackDamage>(new_effect, i->damage);
-                } else if (i->type == Effect::DASH) {
-                    if (!world.has<entt::tag<"wall"_hs>>(receiver)) {
-                        if (!world.has<engine::Copy<Speed>>(receiver)) {
-                            world.emplace<engine::Copy<Speed>>(receiver, world.get<Speed>(receiver));
-                        }
-                        world.replace<Speed>(receiver, world.get<Speed>(receiver).speed / i->strength);
-
-                        if (!world.has<engine::Copy<engine::Color>>(receiver)) {
-                            const auto &current_color = world.get<engine::Color>(receiver);
-                            world.emplace<engine::Copy<engine::Color>>(receiver, current_color);
-                        }
-                        engine::DrawableFactory::fix_color(world, receiver, {0, 0, 1, 1});
-                    }
+            if (effect.type == Effect::DASH && !world.has<entt::tag<"wall"_hs>>(receiver)) {
+                if (!world.has<engine::Copy<Speed>>(receiver)) {
+                    world.emplace<engine::Copy<Speed>>(receiver, world.get<Speed>(receiver));
+                }
+                world.replace<Speed>(receiver, world.get<Speed>(receiver).speed / effect.strength);
+
+                if (!world.has<engine::Copy<engine::Color>>(receiver)) {
+                    const auto &current_color = world.get<engine::Color>(receiver);
+                    world.emplace<engine::Copy<engine::Color>>(receiver, current_color);
                 }
+                engine::DrawableFactory::fix_color(world, receiver, {0, 0, 1, 1});
             }
         }
 
         if (world.has<entt::tag<"projectile"_hs>>(spell)) {
-            onDamageTaken.publish(world, receiver, sender, spell);
+            const auto damage = world.has<AttackDamage>(spell) ? world.get<AttackDamage>(spell).damage : 0.0f;
+            onDamageTaken.publish(world, receiver, sender, spell, damage);
             if (world.valid(spell)) { world.destroy(spell); }
         }
     }
 }
 
-auto game::GameLogic::slots_damage_taken(entt::registry &world, entt::entity receiver, entt::entity sender, entt::entity spell)
-    -> void
+auto game::GameLogic::slots_damage_taken(
+    entt::registry &world, entt::entity receiver, entt::entity sender, entt::entity spell, float damage) -> void
 {
     auto holder = engine::Core::Holder{};
 
-    if (!world.valid(receiver) || !world.has<Health>(receiver) || !world.valid(spell) || !world.valid(sender)) {
-        return;
-    }
+    if (!world.valid(receiver) || !world.has<Health>(receiver) || !world.valid(sender)) { return; }
 
     auto &entity_health = world.get<Health>(receiver);
-    entity_health.current -= world.has<AttackDamage>(spell) ? world.get<AttackDamage>(spell).damage : 0;
+    entity_health.current -= damage;
 
     const auto is_player = world.has<entt::tag<"player"_hs>>(receiver);
     const auto is_wall = world.has<entt::tag<"wall"_hs>>(receiver);
@@ -226,28 +219,36 @@ auto game::GameLogic::slots_damage_taken(entt::registry &world, entt::entity rec
 
     if (!is_wall) {
         const auto &entity_pos = world.get<engine::d3::Position>(receiver);
-        const auto &spell_pos = world.try_get<engine::d3::Position>(spell);
+        const auto &spell_pos = world.valid(spell) ? world.try_get<engine::d3::Position>(spell) : nullptr;
         const auto particule_pos =
             spell_pos ? glm::vec2{(spell_pos->x + entity_pos.x) / 2.0, (entity_pos.y + spell_pos->y) / 2.0}
                       : glm::vec2{entity_pos.x, entity_pos.y};
         ParticuleFactory::create<Particule::HITMARKER>(
             world, particule_pos, is_player ? glm::vec3{255, 0, 0} : glm::vec3{0, 0, 0});
 
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/fire_hit.wav")->play();
+        // note : an area spell hits many entities in the same frame, see @engine::SoundEvents
+        holder.instance->getAudioManager().events().post("sounds/fire_hit.wav"_rid, engine::SoundPriority::LOW);
     }
 
     if (entity_health.current <= 0.0f) {
         onEntityKilled.publish(world, receiver, sender);
-        world.destroy(spell);
+        if (world.valid(spell)) world.destroy(spell);
     } else {
-        auto new_effect = world.create();
-        world.emplace<entt::tag<"effect"_hs>>(new_effect);
-        world.emplace<engine::Source>(new_effect, receiver);
-        world.emplace<engine::SourceBis>(new_effect, sender);
-        world.emplace<engine::Lifetime>(new_effect, 200ms);
-        world.emplace<engine::Cooldown>(new_effect, true, 180ms, 180ms);
-
-        world.emplace<Effect::Type>(new_effect, Effect::Type::DASH);
+        auto &status = world.get_or_emplace<StatusEffects>(receiver);
+        if (auto found = status.find(StatusEffects::HIT); found) {
+            found->lifetime = 200ms;
+            found->cd = {true, 180ms, 180ms};
+        } else if (!status.add({
+                       .id = StatusEffects::HIT,
+                       .type = Effect::Type::DASH,
+                       .damage = 0.0f,
+                       .sender = sender,
+                       .lifetime = 200ms,
+                       .cd = {true, 180ms, 180ms},
+                   })) {
+            // note : without the effect nothing would give the color back, the flash is skipped
+            return;
+        }
 
         if (!world.has<engine::Copy<engine::Color>>(receiver)) {
             const auto &current_color = world.get<engine::Color>(receiver);
@@ -282,10 +283,11 @@ auto game::GameLogic::slots_cast_spell(entt::registry &world, entt::entity caste
                 return false;
         }(vel, aiming);
 
-        const auto animation = fmt::format("{}_{}", "attack", isFacingLeft ? "left" : "right");
+        const auto animation = isFacingLeft ? "attack_left" : "attack_right";
         engine::DrawableFactory::fix_spritesheet(world, caster, animation);
-        world.get<engine::Spritesheet>(caster).attack_animation_finish = false;
-        SpellFactory::create(m_game.dbSpells(), world, caster, glm::normalize(direction), m_game.dbSpells().db.at(std::string{spell.id}));
+        world.get<engine::AnimationState>(caster).attack_animation_finish = false;
+        SpellFactory::create(
+            m_game.dbSpells(), world, caster, glm::normalize(direction), m_game.dbSpells().db[spell.id]);
         spell.cd.remaining_cooldown = spell.cd.cooldown;
         spell.cd.is_in_cooldown = true;
     }
@@ -318,12 +320,11 @@ auto game::GameLogic::slots_kill_entity(entt::registry &world, entt::entity kill
     static auto holder = engine::Core::Holder{};
 
     engine::DrawableFactory::fix_spritesheet(world, killed, "death");
-    try {
-        const auto &animation = world.get<engine::Spritesheet>(killed).animations["death"];
-
+    if (const auto &state = world.get<engine::AnimationState>(killed); state.is("death")) {
+        const auto &animation = state.current();
         world.emplace_or_replace<engine::Lifetime>(
             killed, std::chrono::milliseconds(animation.frames.size() * animation.cooldown));
-    } catch (...) {
+    } else {
         world.emplace_or_replace<engine::Lifetime>(killed, 0ms);
     }
     world.get<engine::d2::Velocity>(killed) = {0.0, 0.0};
@@ -336,23 +337,19 @@ auto game::GameLogic::slots_kill_entity(entt::registry &world, entt::entity kill
 
         auto &spell_on_death = world.get<SpellSlots>(killed).spells[0];
         onSpellCast.publish(world, killed, glm::dvec2{0.0, 1.0}, spell_on_death.value());
-        world.emplace_or_replace<engine::Lifetime>(killed, m_game.dbSpells().db.at(std::string{spell_on_death.value().id}).lifetime);
+        world.emplace_or_replace<engine::Lifetime>(killed, m_game.dbSpells().db[spell_on_death.value().id].lifetime);
 
     } if (world.has<entt::tag<"player"_hs>>(killed)) {
-        holder.instance->getAudioManager()
-            .getSound(holder.instance->settings().data_folder + "sounds/player_death.wav")
-            ->play();
+        holder.instance->getAudioManager().getSound("sounds/player_death.wav"_rid, engine::SoundPriority::HIGH).play();
 
         m_game.setMenu(std::make_unique<menu::GameOver>(EndGameStats(world, killed, m_gameTime)));
 
     } else if (world.has<entt::tag<"enemy"_hs>>(killed)) {
         // TODO: actual random utilities
         bool lazyDevCoinflip = static_cast<std::uint32_t>(killed) % 2;
-        holder.instance->getAudioManager()
-            .getSound(
-                lazyDevCoinflip ? holder.instance->settings().data_folder + "sounds/death/death_01.wav"
-                                : holder.instance->settings().data_folder + "sounds/death/death_02.wav")
-            ->play();
+        holder.instance->getAudioManager().events().post(
+            lazyDevCoinflip ? "sounds/death/death_01.wav"_rid : "sounds/death/death_02.wav"_rid,
+            engine::SoundPriority::LOW);
 
         if (world.has<entt::tag<"player"_hs>>(killer)) {
             addXp(world, killer, world.get<Experience>(killed).xp);
@@ -363,8 +360,8 @@ auto game::GameLogic::slots_kill_entity(entt::registry &world, entt::entity kill
             const auto &pos = world.get<engine::d3::Position>(killed);
             EntityFactory::create<EntityFactory::KEY>(m_game, world, {pos.x, pos.y}, {1.0, 1.0});
             holder.instance->getAudioManager()
-                .getSound(holder.instance->settings().data_folder + "sounds/death/boss_death.wav")
-                ->play();
+                .getSound("sounds/death/boss_death.wav"_rid, engine::SoundPriority::HIGH)
+                .play();
         }
     }
 }
@@ -2,6 +2,7 @@
 #include <Engine/component/VBOTexture.hpp>
 #include <Engine/Core.hpp>
 #include <Engine/Graphics/Window.hpp>
+#include <Engine/TaskGraph.hpp>
 
 #include "models/Spell.hpp"
 #include "models/Class.hpp"
@@ -19,8 +20,6 @@ auto game::ThePURGE::onCreate([[maybe_unused]] entt::registry &world) -> void
 {
     static auto holder = engine::Core::Holder{};
 
-    game::Fonts::loadFonts();
-
 #ifndef NDEBUG
     m_console = std::make_unique<DebugConsole>(*this);
     m_console->info("Press TAB to autocomplete known commands.\nPress F1 to toggle this console");
@@ -30,22 +29,41 @@ auto game::ThePURGE::onCreate([[maybe_unused]] entt::registry &world) -> void
 
     m_logics = std::make_unique<GameLogic>(*this);
 
+    auto &startup = holder.instance->getStartup();
+
+    // note : the atlas is rasterized here rather than by the first frame
+    startup.add("fonts", [] {
+        game::Fonts::loadFonts();
+        ImGui::GetIO().Fonts->Build();
+    });
+
+    // note : a database is loaded after the ones it refers to, the references are resolved to ids while loading
     const auto data_folder = holder.instance->settings().data_folder;
-    spdlog::trace("Loading the spells");
-    m_db_spell.fromFile(data_folder + "db/spells.json");
-    spdlog::trace("OK");
-    spdlog::trace("Loading the classes");
-    m_db_class.fromFile(data_folder + "db/classes.json");
-    spdlog::trace("OK");
-    spdlog::trace("Loading the enemies");
-    m_db_enemy.fromFile(data_folder + "db/enemies.json");
-    spdlog::trace("OK");
-    spdlog::trace("Loading the effects");
-    m_db_effects.fromFile(data_folder + "db/effects.json");
-    spdlog::trace("OK");
-
-    setMenu(std::make_unique<menu::MainMenu>());
-    setBackgroundMusic("sounds/menu/background_music.wav", 0.5f);
+    const auto effects =
+        startup.add("effects", [this, data_folder] { m_db_effects.fromFile(data_folder + "db/effects.json"); });
+    const auto spells = startup.add(
+        "spells",
+        [this, data_folder] { m_db_spell.fromFile(data_folder + "db/spells.json", m_db_effects); },
+        {effects});
+    startup.add(
+        "classes", [this, data_folder] { m_db_class.fromFile(data_folder + "db/classes.json", m_db_spell); }, {spells});
+    startup.add(
+        "enemies", [this, data_folder] { m_db_enemy.fromFile(data_folder + "db/enemies.json", m_db_spell); }, {spells});
+    // note : the audio manager has no lock, it is only touched by the main thread
+    const auto sounds = startup.add(
+        "sounds",
+        [data_folder] { holder.instance->getAudioManager().events().fromFile(data_folder + "db/sounds.json"); },
+        {},
+        engine::TaskGraph::MAIN_THREAD);
+
+    startup.add(
+        "menu",
+        [this] {
+            setMenu(std::make_unique<menu::MainMenu>());
+            setBackgroundMusic("sounds/menu/background_music.wav", 0.5f);
+        },
+        {sounds}, // note : both use the audio manager, the rules are installed before the first sound is played
+        engine::TaskGraph::MAIN_THREAD);
 
     spdlog::info("Starting the game");
     holder.instance->window()->setCursorVisible(false);
@@ -94,6 +112,6 @@ void game::ThePURGE::setBackgroundMusic(const std::string &path, float volume) n
 
     if (m_background_music) m_background_music->stop();
 
-    m_background_music = holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + path);
+    m_background_music = holder.instance->getAudioManager().getMusic(engine::ResourceId::intern(path));
     m_background_music->setVolume(volume).setLoop(true).play();
 }
@@ -2,6 +2,7 @@
 #include <Engine/component/VBOTexture.hpp>
 #include <Engine/component/Rotation.hpp>
 #include <Engine/helpers/DrawableFactory.hpp>
+#include <Engine/resources/AssetLoader.hpp>
 #include <Engine/Core.hpp>
 
 #include "models/Spell.hpp"
@@ -31,11 +32,12 @@ auto game::EntityFactory::create([[maybe_unused]] ThePURGE &game, entt::registry
 
     engine::DrawableFactory::fix_color(world, enemy, glm::vec4{data.color});
 
-    world.emplace<engine::Spritesheet>(
-        enemy, engine::Spritesheet::from_json(holder.instance->settings().data_folder + data.asset));
-
     // note : this does not set animation as wished
-    engine::DrawableFactory::fix_spritesheet(world, enemy, (std::rand() & 1) ? "idle_right" : "idle_left");
+    engine::DrawableFactory::fix_spritesheet(
+        world,
+        enemy,
+        holder.instance->getAssetLoader().spritesheet(data.asset),
+        (std::rand() & 1) ? "idle_right" : "idle_left");
 
     world.emplace<engine::d2::Velocity>(enemy, 0.0, 0.0);
 
@@ -53,21 +55,6 @@ auto game::EntityFactory::create([[maybe_unused]] ThePURGE &game, entt::registry
         if (i == "wall") world.emplace<entt::tag<"wall"_hs>>(enemy);
     }
 
-#ifndef NDEBUG
-
-    auto hitbox_entity = world.create();
-    world.emplace<entt::tag<"debug_hitbox"_hs>>(hitbox_entity);
-    world.emplace<engine::Source>(hitbox_entity, enemy);
-    world.emplace<engine::Drawable>(hitbox_entity, engine::DrawableFactory::rectangle());
-    world.emplace<engine::d2::Rotation>(hitbox_entity, 0.f);
-    world.emplace<engine::d3::Position>(hitbox_entity, pos.x, pos.y, get_z_layer<Layer::LAYER_DEBUG>());
-    world.emplace<engine::d2::Scale>(hitbox_entity, data.hitbox.width, data.hitbox.height);
-    engine::DrawableFactory::fix_color(world, hitbox_entity, {1, 1, 1, 0.5});
-    engine::DrawableFactory::fix_texture(
-        world, hitbox_entity, holder.instance->settings().data_folder + "img/transparent.png");
-
-#endif
-
     return enemy;
 }
 
@@ -98,7 +85,7 @@ auto game::EntityFactory::create<game::EntityFactory::PLAYER>(
     engine::DrawableFactory::fix_color(world, player, {1.0f, 1.0f, 1.0f, 1.0f});
 
     // class dependant, see `GameLogic::apply_class_to_player`
-    world.emplace<engine::Spritesheet>(player);
+    world.emplace<engine::AnimationState>(player);
     world.emplace<Health>(player, 0.f, 0.f);
     world.emplace<AttackDamage>(player, 0.f);
     world.emplace<Speed>(player, 5.f);
@@ -122,7 +109,7 @@ auto game::EntityFactory::create<game::EntityFactory::KEY>(
     world.emplace<engine::d2::Scale>(key, size.x, size.y);
     world.emplace<engine::Drawable>(key, engine::DrawableFactory::rectangle());
     engine::DrawableFactory::fix_color(world, key, {1, 1, 0, 1});
-    engine::DrawableFactory::fix_texture(world, key, holder.instance->settings().data_folder + "img/key.png");
+    engine::DrawableFactory::fix_texture(world, key, "img/key.png"_rid);
     return key;
 }
 
@@ -142,7 +129,7 @@ auto game::EntityFactory::create<game::EntityFactory::AIMING_SIGHT>(
 
     world.emplace<engine::Drawable>(e, engine::DrawableFactory::rectangle());
 
-    engine::DrawableFactory::fix_texture(world, e, holder.instance->settings().data_folder + "img/aim_sight.png");
+    engine::DrawableFactory::fix_texture(world, e, "img/aim_sight.png"_rid);
 
     return e;
 }
@@ -168,7 +155,7 @@ auto game::EntityFactory::create<game::EntityFactory::FLOOR_NORMAL>(
     world.emplace<engine::Drawable>(e, engine::DrawableFactory::rectangle());
     engine::DrawableFactory::fix_color(world, e, {0.3, 0.3, 0.3, 1});
     engine::DrawableFactory::fix_texture(
-        world, e, holder.instance->settings().data_folder + TexturePath::floor_normal, true, {0.0f, 0.0f, size.x, size.y});
+        world, e, engine::ResourceId{TexturePath::floor_normal}, true, {0.0f, 0.0f, size.x, size.y});
     world.emplace<entt::tag<"terrain"_hs>>(e);
     return e;
 }
@@ -186,7 +173,7 @@ auto game::EntityFactory::create<game::EntityFactory::FLOOR_SPAWN>(
     world.emplace<engine::Drawable>(e, engine::DrawableFactory::rectangle());
     engine::DrawableFactory::fix_color(world, e, {0.3, 0.3, 0.3, 1});
     engine::DrawableFactory::fix_texture(
-        world, e, holder.instance->settings().data_folder + TexturePath::floor_spawn, true, {0.0f, 0.0f, size.x, size.y});
+        world, e, engine::ResourceId{TexturePath::floor_spawn}, true, {0.0f, 0.0f, size.x, size.y});
     world.emplace<entt::tag<"terrain"_hs>>(e);
     return e;
 }
@@ -204,7 +191,7 @@ auto game::EntityFactory::create<game::EntityFactory::FLOOR_BOSS>(
     world.emplace<engine::Drawable>(e, engine::DrawableFactory::rectangle());
     engine::DrawableFactory::fix_color(world, e, {0.3, 0.3, 0.3, 1});
     engine::DrawableFactory::fix_texture(
-        world, e, holder.instance->settings().data_folder + TexturePath::floor_boss, true, {0.0f, 0.0f, size.x, size.y});
+        world, e, engine::ResourceId{TexturePath::floor_boss}, true, {0.0f, 0.0f, size.x, size.y});
     world.emplace<entt::tag<"terrain"_hs>>(e);
     return e;
 }
@@ -222,7 +209,7 @@ auto game::EntityFactory::create<game::EntityFactory::FLOOR_CORRIDOR>(
     world.emplace<engine::Drawable>(e, engine::DrawableFactory::rectangle());
     engine::DrawableFactory::fix_color(world, e, {0.3, 0.3, 0.3, 1});
     engine::DrawableFactory::fix_texture(
-        world, e, holder.instance->settings().data_folder + TexturePath::floor_corridor, true, {0.0f, 0.0f, size.x, size.y});
+        world, e, engine::ResourceId{TexturePath::floor_corridor}, true, {0.0f, 0.0f, size.x, size.y});
     world.emplace<entt::tag<"terrain"_hs>>(e);
     return e;
 }
@@ -239,7 +226,7 @@ auto game::EntityFactory::create<game::EntityFactory::EXIT_DOOR>(
     world.emplace<engine::d2::Scale>(e, size.x, size.y);
     world.emplace<engine::Drawable>(e, engine::DrawableFactory::rectangle());
     engine::DrawableFactory::fix_color(world, e, {1, 1, 1, 1});
-    engine::DrawableFactory::fix_texture(world, e, holder.instance->settings().data_folder + "img/map/door.png");
+    engine::DrawableFactory::fix_texture(world, e, "img/map/door.png"_rid);
 
     world.emplace<engine::d2::HitboxSolid>(e, size.x, size.y);
     world.emplace<entt::tag<"terrain"_hs>>(e);
@@ -7,6 +7,7 @@
 #include <Engine/component/VBOTexture.hpp>
 #include <Engine/component/Rotation.hpp>
 #include <Engine/helpers/DrawableFactory.hpp>
+#include <Engine/resources/AssetLoader.hpp>
 #include <Engine/Core.hpp>
 
 #include "models/Spell.hpp"
@@ -23,16 +24,19 @@ auto game::SpellFactory::create(SpellDatabase &db, entt::registry &world, entt::
 
     spdlog::trace("Casting a spell {}", data.name);
 
-    holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + data.audio_on_cast)->play();
+    holder.instance->getAudioManager().events().post(data.audio_on_cast, engine::SoundPriority::LOW);
 
     const auto &caster_pos = world.get<engine::d3::Position>(caster);
 
+    // note : shared by every projectile, nothing is parsed or copied by a cast
+    const auto &spritesheet = holder.instance->getAssetLoader().spritesheet(data.animation);
+
     for (int i = 0; i != data.quantity; i++) {
         const auto spell = world.create();
         world.emplace<entt::tag<"spell"_hs>>(spell);
         world.emplace<engine::Drawable>(spell, engine::DrawableFactory::rectangle());
         engine::DrawableFactory::fix_color(world, spell, {1, 1, 1, 1}); // todo : add color in db ?
-        [[maybe_unused]] const auto &pos = world.emplace<engine::d3::Position>(
+        world.emplace<engine::d3::Position>(
             spell,
             caster_pos.x + (data.scale.x / 3.0 + data.offset_to_source_x) * direction.x,
             caster_pos.y + (data.scale.y / 3.0 + data.offset_to_source_y) * direction.y,
@@ -44,9 +48,7 @@ auto game::SpellFactory::create(SpellDatabase &db, entt::registry &world, entt::
         world.emplace<game::AttackDamage>(spell, data.damage);
         world.emplace<engine::Lifetime>(spell, data.lifetime);
 
-        world.emplace<engine::Spritesheet>(
-            spell, engine::Spritesheet::from_json(holder.instance->settings().data_folder + data.animation));
-        engine::DrawableFactory::fix_spritesheet(world, spell, "default");
+        engine::DrawableFactory::fix_spritesheet(world, spell, spritesheet, "default");
 
         const auto cross = glm::cross(glm::dvec3(1, 0, 0), glm::dvec3(0, 1, 0));
         const auto matrix_rotation = glm::rotate(glm::dmat4(1.0f), i * data.angle, cross);
@@ -73,20 +75,6 @@ auto game::SpellFactory::create(SpellDatabase &db, entt::registry &world, entt::
         } else {
             world.emplace<engine::d2::HitboxFloat>(spell, data.hitbox);
         }
-
-#ifndef NDEBUG
-        auto hitbox_entity = world.create();
-        world.emplace<entt::tag<"debug_hitbox"_hs>>(hitbox_entity);
-        world.emplace<engine::Source>(hitbox_entity, spell);
-        world.emplace<engine::Drawable>(hitbox_entity, engine::DrawableFactory::rectangle());
-        world.emplace<engine::d2::Rotation>(hitbox_entity, 0.f);
-        world.emplace<engine::d3::Position>(
-            hitbox_entity, pos.x, pos.y, EntityFactory::get_z_layer<EntityFactory::Layer::LAYER_DEBUG>());
-        world.emplace<engine::d2::Scale>(hitbox_entity, data.hitbox.width, data.hitbox.height);
-        engine::DrawableFactory::fix_color(world, hitbox_entity, {1, 1, 1, 0.5});
-        engine::DrawableFactory::fix_texture(
-            world, hitbox_entity, holder.instance->settings().data_folder + "img/transparent.png");
-#endif
     }
 
     return {};
@@ -12,11 +12,7 @@
 
 void game::menu::Credits::create(entt::registry &, ThePURGE &)
 {
-    static auto holder = engine::Core::Holder{};
-
-    const auto &dataFolder = holder.instance->settings().data_folder;
-
-    m_texture = engine::helper::loadTexture(dataFolder + "img/menu/credits.png");
+    m_texture = "img/menu/credits.png"_rid;
 }
 
 void game::menu::Credits::draw(entt::registry &, ThePURGE &game)
@@ -31,7 +27,7 @@ void game::menu::Credits::draw(entt::registry &, ThePURGE &game)
 
 
     if (close()) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/back.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/back.wav"_rid).play();
 
         game.setMenu(std::make_unique<menu::MainMenu>());
     }
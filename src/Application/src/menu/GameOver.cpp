@@ -18,23 +18,18 @@ auto game::menu::GameOver::clean_world(entt::registry &world) -> void { Stage{}.
 
 void game::menu::GameOver::create(entt::registry &, ThePURGE &)
 {
-    static auto holder = engine::Core::Holder{};
-
-    const auto &dataFolder = holder.instance->settings().data_folder;
-
-
-    m_backgroundTexture = engine::helper::loadTexture(dataFolder + "img/menu/game_over/background.png");
+    m_backgroundTexture = "img/menu/game_over/background.png"_rid;
 
     // clang-format off
 
     // SAME ORDER AS `Button` ENUM
     m_buttons.emplace_back(GUITexture{
-        helper::getTexture("img/menu/game_over/btn_playagain_selected.png"),
+        "img/menu/game_over/btn_playagain_selected.png"_rid,
         helper::from1080p(701, 665),
         helper::from1080p(515, 156)
     });
     m_buttons.emplace_back(GUITexture{
-        helper::getTexture("img/menu/game_over/btn_menu_selected.png"),
+        "img/menu/game_over/btn_menu_selected.png"_rid,
         helper::from1080p(822, 884),
         helper::from1080p(276, 149)
     });
@@ -60,12 +55,12 @@ void game::menu::GameOver::draw(entt::registry &world, ThePURGE &game)
         ImVec4(1, 1, 1, static_cast<float>(std::clamp(m_timeElapsed, 0.0, 1.0))));
 
     if (up() && m_selected > 0) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/change.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/change.wav"_rid).play();
 
         m_selected--;
     }
     if (down() && m_selected < Button::MAX - 1) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/change.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/change.wav"_rid).play();
 
         m_selected++;
     }
@@ -82,7 +77,7 @@ void game::menu::GameOver::draw(entt::registry &world, ThePURGE &game)
         forceSelect(true);
     }
     if (select()) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/accept.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/accept.wav"_rid).play();
         clean_world(world);
 
         switch (m_selected) {
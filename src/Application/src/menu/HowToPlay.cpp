@@ -12,12 +12,8 @@
 
 void game::menu::HowToPlay::create(entt::registry &, ThePURGE &)
 {
-    static auto holder = engine::Core::Holder{};
-
-    const auto &dataFolder = holder.instance->settings().data_folder;
-
-    m_howToPlay = engine::helper::loadTexture(dataFolder + "img/menu/how_to_play/howtoplay.png");
-    m_controls = engine::helper::loadTexture(dataFolder + "img/menu/how_to_play/controls.png");
+    m_howToPlay = "img/menu/how_to_play/howtoplay.png"_rid;
+    m_controls = "img/menu/how_to_play/controls.png"_rid;
 }
 
 void game::menu::HowToPlay::draw(entt::registry &, ThePURGE &game)
@@ -29,12 +25,12 @@ void game::menu::HowToPlay::draw(entt::registry &, ThePURGE &game)
     ImGui::Begin("HowToPlay", nullptr, ImGuiWindowFlags_NoDecoration);
 
     if (right()) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/change.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/change.wav"_rid).play();
 
         m_currentTab = Tab::CONTROLS;
     }
     if (left()) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/change.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/change.wav"_rid).play();
 
         m_currentTab = Tab::HOW_TO_PLAY;
     }
@@ -47,7 +43,7 @@ void game::menu::HowToPlay::draw(entt::registry &, ThePURGE &game)
     ImGui::End();
 
     if (close()) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/back.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/back.wav"_rid).play();
 
         game.setMenu(std::make_unique<menu::MainMenu>());
     }
@@ -12,33 +12,28 @@
 
 void game::menu::MainMenu::create(entt::registry &, ThePURGE &)
 {
-    static auto holder = engine::Core::Holder{};
-
-    const auto &dataFolder = holder.instance->settings().data_folder;
-
-
-    m_backgroundTexture = engine::helper::loadTexture(dataFolder + "img/menu/main/mainmenu.png");
+    m_backgroundTexture = "img/menu/main/mainmenu.png"_rid;
 
     // clang-format off
 
     // SAME ORDER AS `Button` ENUM
     m_buttons.emplace_back(GUITexture{
-        helper::getTexture("img/menu/main/btn_play_selected.png"),
+        "img/menu/main/btn_play_selected.png"_rid,
         helper::from1080p(1238, 259),
         helper::from1080p(229, 155)
     });
     m_buttons.emplace_back(GUITexture{
-        helper::getTexture("img/menu/main/btn_howtoplay_selected.png"),
+        "img/menu/main/btn_howtoplay_selected.png"_rid,
         helper::from1080p(1062, 441),
         helper::from1080p(590, 155)
     });
     m_buttons.emplace_back(GUITexture{
-        helper::getTexture("img/menu/main/btn_credits_selected.png"),
+        "img/menu/main/btn_credits_selected.png"_rid,
         helper::from1080p(1195, 629),
         helper::from1080p(345, 149)
     });
     m_buttons.emplace_back(GUITexture{
-        helper::getTexture("img/menu/main/btn_exit_selected.png"),
+        "img/menu/main/btn_exit_selected.png"_rid,
         helper::from1080p(1263, 820),
         helper::from1080p(195, 149)
     });
@@ -58,12 +53,12 @@ void game::menu::MainMenu::draw(entt::registry &world, ThePURGE &game)
     helper::drawTexture(m_backgroundTexture, ImVec2(0, 0), helper::frac2pixel({1.f, 1.f}));
 
     if (up() && m_selected > 0) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/change.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/change.wav"_rid).play();
 
         m_selected--;
     }
     if (down() && m_selected < Button::MAX - 1) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/change.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/change.wav"_rid).play();
 
         m_selected++;
     }
@@ -73,7 +68,7 @@ void game::menu::MainMenu::draw(entt::registry &world, ThePURGE &game)
     ImGui::End();
 
     if (select()) {
-        holder.instance->getAudioManager().getSound(holder.instance->settings().data_folder + "sounds/menu/accept.wav")->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/accept.wav"_rid).play();
 
         switch (m_selected) {
         case Button::PLAY:
@@ -26,13 +26,13 @@ void game::menu::UpgradePanel::create(entt::registry &world, ThePURGE &game)
     holder.instance->setEventMode(engine::Core::EventMode::PAUSED);
 
     m_static_background = GUITexture{
-        helper::getTexture("img/menu/upgrade_panel/static_background.png"),
+        "img/menu/upgrade_panel/static_background.png"_rid,
         ImVec2(0, 0),
         ImVec2(1, 1),
     };
 
     m_bind_popup = GUITexture{
-        helper::getTexture("img/menu/upgrade_panel/key_assignment_popup.png"),
+        "img/menu/upgrade_panel/key_assignment_popup.png"_rid,
         ImVec2(0, 0),
         ImVec2(1, 1),
     };
@@ -44,13 +44,11 @@ void game::menu::UpgradePanel::create(entt::registry &world, ThePURGE &game)
 
     updateClassTree(world, game);
 
-    m_selection = findInTree(game.dbClasses().getByName(ownedClasses.back()));
+    m_selection = findInTree(&game.dbClasses().db[ownedClasses.back()]);
     m_cursorDestinationPos = m_selection->relPos;
     m_cursorCurrentPos = m_cursorDestinationPos;
 
-    holder.instance->getAudioManager()
-        .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/open_close.wav")
-        ->play();
+    holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/open_close.wav"_rid).play();
 }
 
 void game::menu::UpgradePanel::draw(entt::registry &world, ThePURGE &game)
@@ -84,30 +82,30 @@ void game::menu::UpgradePanel::draw(entt::registry &world, ThePURGE &game)
 void game::menu::UpgradePanel::drawDetailPanel(entt::registry &world, ThePURGE &game) noexcept
 {
     const auto skillPoints = world.get<SkillPoint>(m_player).count;
-    const auto &selectedClassSpell = game.dbSpells().db.at(m_selection->cl->spells.front());
+    const auto &selectedClassSpell = game.dbSpells().db[m_selection->cl->spells.front()];
 
     const GUITexture portrait{
-        helper::getTexture(m_selection->cl->iconPath),
+        m_selection->cl->iconPath,
         helper::from1080p(58, 226),
         helper::from1080p(158, 179),
     };
     const GUITexture spellPortrait{
-        helper::getTexture(selectedClassSpell.iconPath),
+        selectedClassSpell.iconPath,
         helper::from1080p(64, 416),
         helper::from1080p(100, 100),
     };
     const GUITexture btn_buy{
-        helper::getTexture("img/menu/upgrade_panel/button/buy.png"),
+        "img/menu/upgrade_panel/button/buy.png"_rid,
         helper::from1080p(119, 855),
         helper::from1080p(317, 197),
     };
     const GUITexture btn_cant{
-        helper::getTexture("img/menu/upgrade_panel/button/cant.png"),
+        "img/menu/upgrade_panel/button/cant.png"_rid,
         helper::from1080p(119, 855),
         helper::from1080p(317, 197),
     };
     const GUITexture btn_alreadyowned{
-        helper::getTexture("img/menu/upgrade_panel/button/owned.png"),
+        "img/menu/upgrade_panel/button/owned.png"_rid,
         helper::from1080p(119, 855),
         helper::from1080p(317, 197),
     };
@@ -192,9 +190,7 @@ void game::menu::UpgradePanel::processInputs(entt::registry &world, ThePURGE &ga
         }
 
     if (previousSelection != m_selection) {
-        holder.instance->getAudioManager()
-            .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/tree_select.wav")
-            ->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/tree_select.wav"_rid).play();
 
         m_cursorDestinationPos = m_selection->relPos;
     }
@@ -203,17 +199,13 @@ void game::menu::UpgradePanel::processInputs(entt::registry &world, ThePURGE &ga
     if (select()) {
         if (isPurchaseable(m_selection->cl) && sp >= m_selection->cl->cost) {
             game.logics()->onPlayerPurchase.publish(world, m_player, *m_selection->cl);
-            holder.instance->getAudioManager()
-                .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/buy_class.wav")
-                ->play();
+            holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/buy_class.wav"_rid).play();
 
-            m_spellBeingAssigned = &game.dbSpells().db.at(m_selection->cl->spells.front());
+            m_spellBeingAssigned = &game.dbSpells().db[m_selection->cl->spells.front()];
             updateClassTree(world, game);
-            m_selection = findInTree(game.dbClasses().getByName(world.get<Classes>(m_player).ids.back()));
+            m_selection = findInTree(&game.dbClasses().db[world.get<Classes>(m_player).ids.back()]);
         } else
-            holder.instance->getAudioManager()
-                .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/error.wav")
-                ->play();
+            holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/error.wav"_rid).play();
     }
 }
 
@@ -230,14 +222,10 @@ void game::menu::UpgradePanel::onBuyHp(entt::registry &world)
     if (sp >= kCost && health.current < health.max) {
         sp -= kCost;
         health.current = std::min(health.current + kHeal, health.max);
-        holder.instance->getAudioManager()
-            .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/heal.wav")
-            ->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/heal.wav"_rid).play();
 
     } else
-        holder.instance->getAudioManager()
-            .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/error.wav")
-            ->play();
+        holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/error.wav"_rid).play();
 }
 
 void game::menu::UpgradePanel::drawTree(entt::registry &, ThePURGE &) noexcept
@@ -260,11 +248,11 @@ void game::menu::UpgradePanel::drawTree(entt::registry &, ThePURGE &) noexcept
         std::uint32_t glowTexture;
 
         if (isOwned(current->cl))
-            glowTexture = helper::getTexture("img/menu/upgrade_panel/tree/frames/owned.png");
+            glowTexture = helper::getTexture("img/menu/upgrade_panel/tree/frames/owned.png"_rid);
         else if (isPurchaseable(current->cl))
-            glowTexture = helper::getTexture("img/menu/upgrade_panel/tree/frames/buyable.png");
+            glowTexture = helper::getTexture("img/menu/upgrade_panel/tree/frames/buyable.png"_rid);
         else
-            glowTexture = helper::getTexture("img/menu/upgrade_panel/tree/frames/unavailable.png");
+            glowTexture = helper::getTexture("img/menu/upgrade_panel/tree/frames/unavailable.png"_rid);
 
         helper::drawTexture(glowTexture, getTreeDrawPos(current->relPos, kFrameSize), ImVec2(kFrameSize, kFrameSize));
 
@@ -275,7 +263,7 @@ void game::menu::UpgradePanel::drawTree(entt::registry &, ThePURGE &) noexcept
     m_cursorCurrentPos.x = std::lerp(m_cursorCurrentPos.x, m_cursorDestinationPos.x, kSelectionAnimationSpeed);
     m_cursorCurrentPos.y = std::lerp(m_cursorCurrentPos.y, m_cursorDestinationPos.y, kSelectionAnimationSpeed);
 
-    const auto cursorTexture = helper::getTexture("img/menu/upgrade_panel/tree/cursor.png");
+    const auto cursorTexture = helper::getTexture("img/menu/upgrade_panel/tree/cursor.png"_rid);
     helper::drawTexture(cursorTexture, getTreeDrawPos(m_cursorCurrentPos, kCursorSize), ImVec2(kCursorSize, kCursorSize));
 }
 
@@ -292,7 +280,7 @@ void game::menu::UpgradePanel::updateClassTree(entt::registry &world, ThePURGE &
     m_classes.clear();
     m_purchaseable.clear();
 
-    for (const auto &name : world.get<Classes>(m_player).ids) m_owned.push_back(game.dbClasses().getByName(name));
+    for (const auto &id : world.get<Classes>(m_player).ids) m_owned.push_back(&game.dbClasses().db[id]);
 
 
     m_classes.push_back({&game.dbClasses().getStarterClass()});
@@ -302,8 +290,8 @@ void game::menu::UpgradePanel::updateClassTree(entt::registry &world, ThePURGE &
         std::vector<const Class *> thisRow;
 
         for (const auto *parent : lastRow) {
-            for (const auto &childName : parent->children) {
-                const auto *child = game.dbClasses().getByName(childName);
+            for (const auto &childId : parent->children) {
+                const auto *child = &game.dbClasses().db[childId];
                 thisRow.push_back(child);
 
                 if (std::find(std::begin(m_owned), std::end(m_owned), parent) != std::end(m_owned))
@@ -351,8 +339,8 @@ auto game::menu::UpgradePanel::generateTreeRec(ThePURGE &game, const Class *cl,
     result.relPos.y = yPos;
     result.relPos.x = 0;
 
-    for (int idx = 0; const auto &childName : cl->children) {
-        result.children.push_back(generateTreeRec(game, game.dbClasses().getByName(childName), idx++, depth + 1));
+    for (int idx = 0; const auto &childId : cl->children) {
+        result.children.push_back(generateTreeRec(game, &game.dbClasses().db[childId], idx++, depth + 1));
         result.relPos.x += result.children.back().relPos.x / static_cast<float>(cl->children.size());
     }
 
@@ -483,7 +471,7 @@ void game::menu::UpgradePanel::event(entt::registry &world, ThePURGE &game, cons
                         const auto id = spell_map(key.source.key);
 
                         world.get<SpellSlots>(m_player).spells[id] =
-                            game.dbSpells().instantiate(m_spellBeingAssigned->name);
+                            game.dbSpells().instantiate(game.dbSpells().db.id(*m_spellBeingAssigned));
 
                         m_spellBeingAssigned = nullptr;
                     } break;
@@ -496,7 +484,7 @@ void game::menu::UpgradePanel::event(entt::registry &world, ThePURGE &game, cons
                     case engine::Joystick::RST: {
                         const auto id = spell_map(joy.source.axis);
                         world.get<SpellSlots>(m_player).spells[id] =
-                            game.dbSpells().instantiate(m_spellBeingAssigned->name);
+                            game.dbSpells().instantiate(game.dbSpells().db.id(*m_spellBeingAssigned));
                         m_spellBeingAssigned = nullptr;
                     } break;
                     default: break;
@@ -508,7 +496,7 @@ void game::menu::UpgradePanel::event(entt::registry &world, ThePURGE &game, cons
                     case engine::Joystick::RS: {
                         const auto id = spell_map(joy.source.button);
                         world.get<SpellSlots>(m_player).spells[id] =
-                            game.dbSpells().instantiate(m_spellBeingAssigned->name);
+                            game.dbSpells().instantiate(game.dbSpells().db.id(*m_spellBeingAssigned));
                         m_spellBeingAssigned = nullptr;
                     } break;
                     default: return;
@@ -519,9 +507,7 @@ void game::menu::UpgradePanel::event(entt::registry &world, ThePURGE &game, cons
             e);
 
         if (!m_spellBeingAssigned)
-            holder.instance->getAudioManager()
-                .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/spell_assign.wav")
-                ->play();
+            holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/spell_assign.wav"_rid).play();
         return;
     }
 
@@ -531,9 +517,7 @@ void game::menu::UpgradePanel::event(entt::registry &world, ThePURGE &game, cons
                 switch (key.source.key) {
                 case GLFW_KEY_ESCAPE:
                 case GLFW_KEY_P:
-                    holder.instance->getAudioManager()
-                        .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/open_close.wav")
-                        ->play();
+                    holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/open_close.wav"_rid).play();
                     holder.instance->setEventMode(engine::Core::EventMode::RECORD);
                     game.setMenu(nullptr);
                     break;
@@ -544,9 +528,7 @@ void game::menu::UpgradePanel::event(entt::registry &world, ThePURGE &game, cons
             [&](const engine::Pressed<engine::JoystickButton> &joy) {
                 switch (joy.source.button) {
                 case engine::Joystick::CENTER2:
-                    holder.instance->getAudioManager()
-                        .getSound(holder.instance->settings().data_folder + "/sounds/menu/upgrade_panel/open_close.wav")
-                        ->play();
+                    holder.instance->getAudioManager().getSound("sounds/menu/upgrade_panel/open_close.wav"_rid).play();
                     holder.instance->setEventMode(engine::Core::EventMode::RECORD);
                     game.setMenu(nullptr);
                     break;
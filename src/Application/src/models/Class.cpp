@@ -1,5 +1,4 @@
 #include <chrono>
-#include <fstream>
 #include <algorithm>
 
 #include <nlohmann/json.hpp>
@@ -7,19 +6,20 @@
 #include <magic_enum.hpp>
 
 #include <Engine/helpers/macro.hpp>
+#include <Engine/resources/FileSystem.hpp>
+#include <Engine/Core.hpp>
 
 #include "models/Class.hpp"
 
-auto game::ClassDatabase::getByName(const std::string_view name) -> const Class *
+auto game::ClassDatabase::getByName(const std::string_view name) const -> const Class *
 {
-    if (const auto found = std::find_if(db.begin(), db.end(), [&name](const auto &i) { return i.name == name; });
-        found != db.end()) {
-        return &(*found);
+    if (const auto found = db.find(name); found != Database<Class>::npos) {
+        return &db[found];
     } else
         UNLIKELY { return nullptr; }
 }
 
-auto game::ClassDatabase::getStarterClass() -> const Class &
+auto game::ClassDatabase::getStarterClass() const -> const Class &
 {
     if (const auto found = std::find_if(db.begin(), db.end(), [](const auto &i) { return i.is_starter; });
         found != db.end()) {
@@ -30,40 +30,36 @@ auto game::ClassDatabase::getStarterClass() -> const Class &
 
 using namespace std::chrono_literals;
 
-auto game::ClassDatabase::fromFile(const std::string_view path) -> ClassDatabase &
+auto game::ClassDatabase::fromFile(const std::string_view path, const SpellDatabase &spells) -> ClassDatabase &
 {
     spdlog::info("Loading class database file: '{}'", path.data());
 
-    std::ifstream file(path.data());
-    if (!file.is_open()) { spdlog::error("Can't open the given file"); }
-    const auto jsonData = nlohmann::json::parse(file);
+    const auto file = engine::Core::Holder{}.instance->getFileSystem().read(path);
+    if (!file.has_value()) { spdlog::error("Can't open the given file"); }
+    const auto jsonData = nlohmann::json::parse(file.has_value() ? file->view() : std::string_view{});
 
     for (const auto &[name, data] : jsonData.items()) {
         Class c{
             .name = name,
-            .iconPath = data["icon"],
-            .assetGraphPath = data["assetGraph"],
+            .iconPath = engine::ResourceId::intern(data["icon"].get<std::string>()),
+            .assetGraphPath = engine::ResourceId::intern(data["assetGraph"].get<std::string>()),
             .is_starter = data.value("starter", false),
             .cost = data["cost"].get<int>(),
             .health = data["health"].get<float>(),
             .speed = data["speed"].get<float>(),
             .hitbox = engine::d2::HitboxSolid{data["hitbox"]["x"].get<double>(), data["hitbox"]["y"].get<double>()},
-            .spells = data["spells"].get<std::vector<std::string>>(),
+            .spells = resolve(spells.db, data["spells"].get<std::vector<std::string>>(), name),
             .children = {},
         };
         // Note creating the `Class` instance during assignment raises internal compiler error on MSVC
         // note : is it still the case ?
         // note : I don't know
-        db.emplace_back(c);
+        db.emplace(name, std::move(c));
     }
 
+    // note : a class can refer to any other class, they are resolved once every class has an id
     for (auto &i : this->db) {
-        for (const auto &child : jsonData[i.name]["children"]) {
-            if (const auto c = getByName(child.get<std::string>()); c) {
-                i.children.push_back(c->name);
-            } else
-                UNLIKELY { spdlog::warn("Unknown class '{}'. Ignoring", child); }
-        }
+        i.children = resolve(db, jsonData[i.name].value("children", std::vector<std::string>{}), i.name);
     }
 
     for (const auto &classes : this->db) {
@@ -79,22 +75,24 @@ auto game::ClassDatabase::fromFile(const std::string_view path) -> ClassDatabase
             "\thitbox={},{}\n"
             "\tchildren={}\n",
             classes.name,
-            classes.iconPath,
-            classes.assetGraphPath,
+            classes.iconPath.path(),
+            classes.assetGraphPath.path(),
             classes.is_starter,
             std::accumulate(
                 std::begin(classes.spells),
                 std::end(classes.spells),
                 std::string{},
-                [](auto out, auto &i) { return out + "/" + i; }),
+                [&spells](auto out, auto &i) { return out + "/" + spells.db.name(i); }),
             classes.health,
             classes.speed,
             classes.cost,
             classes.hitbox.width,
             classes.hitbox.height,
-            std::accumulate(std::begin(classes.children), std::end(classes.children), std::string{}, [](auto out, auto &i) {
-                return out + "/" + i;
-            }));
+            std::accumulate(
+                std::begin(classes.children),
+                std::end(classes.children),
+                std::string{},
+                [this](auto out, auto &i) { return out + "/" + db.name(i); }));
     }
 
     return *this;
@@ -1,19 +1,21 @@
-#include <fstream>
 
 #include <spdlog/spdlog.h>
 
+#include <Engine/resources/FileSystem.hpp>
+#include <Engine/Core.hpp>
+
 #include "models/Effect.hpp"
 
 auto game::EffectDatabase::fromFile(const std::string_view path) -> bool
 {
-    std::ifstream file(path.data());
-    if (!file.is_open()) {
+    const auto file = engine::Core::Holder{}.instance->getFileSystem().read(path);
+    if (!file.has_value()) {
         spdlog::error("Can't open the given file");
         return false;
     }
-    const auto jsonData = nlohmann::json::parse(file);
+    const auto jsonData = nlohmann::json::parse(file->view());
 
-    this->db = jsonData.get<std::decay_t<decltype(this->db)>>();
+    for (const auto &[name, data] : jsonData.items()) this->db.emplace(name, data.get<Effect>());
 
     return true;
 }
@@ -1,19 +1,25 @@
-#include <fstream>
 
 #include <spdlog/spdlog.h>
 
+#include <Engine/resources/FileSystem.hpp>
+#include <Engine/Core.hpp>
+
 #include "models/Enemy.hpp"
 
-bool game::EnemyDatabase::fromFile(const std::string_view path)
+bool game::EnemyDatabase::fromFile(const std::string_view path, const SpellDatabase &spells)
 {
-    std::ifstream file(path.data());
-    if (!file.is_open()) {
+    const auto file = engine::Core::Holder{}.instance->getFileSystem().read(path);
+    if (!file.has_value()) {
         spdlog::error("Can't open the given file");
         return false;
     }
-    const auto jsonData = nlohmann::json::parse(file);
+    const auto jsonData = nlohmann::json::parse(file->view());
 
-    this->db = jsonData.get<std::decay_t<decltype(this->db)>>();
+    for (const auto &[name, data] : jsonData.items()) {
+        auto enemy = data.get<Enemy>();
+        enemy.spells = resolve(spells.db, data.at("spells").get<std::vector<std::string>>(), name);
+        this->db.emplace(name, std::move(enemy));
+    }
 
     return true;
 }
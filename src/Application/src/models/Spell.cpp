@@ -1,10 +1,12 @@
 #include <chrono>
 #include <optional>
-#include <fstream>
 
 #include <spdlog/spdlog.h>
 
 #include <Engine/component/Cooldown.hpp>
+#include <Engine/helpers/macro.hpp>
+#include <Engine/resources/FileSystem.hpp>
+#include <Engine/Core.hpp>
 
 #include "factory/SpellFactory.hpp"
 #include "models/Spell.hpp"
@@ -17,7 +19,7 @@ void game::to_json(nlohmann::json &j, const SpellData &spell)
 {
     // clang-format off
     j = nlohmann::json({spell.name, {
-        "icon", spell.iconPath,
+        "icon", std::string{spell.iconPath.path()},
         "description", spell.description,
         "cooldown", spell.cooldown.count(),
         "damage", spell.damage,
@@ -34,47 +36,46 @@ void game::to_json(nlohmann::json &j, const SpellData &spell)
         //    "x": spell.offset_to_source_x,
         //    "y": spell.offset_to_source_y
         //}
-        "audio_on_cast", spell.audio_on_cast,
-        "animation", spell.animation,
+        "audio_on_cast", std::string{spell.audio_on_cast.path()},
+        "animation", std::string{spell.animation.path()},
         "speed", spell.speed
     }});
     // clang-format on
 }
 
 
-auto game::SpellDatabase::instantiate(const std::string_view spell) -> std::optional<Spell>
+auto game::SpellDatabase::instantiate(const SpellId spell) const -> std::optional<Spell>
 {
-    if (const auto found = std::find_if(std::begin(db), std::end(db), [&spell](auto &i) { return i.first == spell; });
-        found != std::end(db)) {
+    if (spell < db.size()) {
         return Spell{
-            .id = found->first,
+            .id = spell,
             .cd = {
                 .is_in_cooldown = false,
-                .cooldown = found->second.cooldown,
+                .cooldown = db[spell].cooldown,
                 .remaining_cooldown = 0ms,
             }};
 
     } else {
-        spdlog::error("SpellDatabase::instantiate: No such spell '{}'", spell.data());
+        spdlog::error("SpellDatabase::instantiate: No such spell '{}'", spell);
         return {};
     }
 }
 
-auto game::SpellDatabase::fromFile(const std::string_view path) -> bool
+auto game::SpellDatabase::fromFile(const std::string_view path, const EffectDatabase &effects) -> bool
 {
-    std::ifstream file(path.data());
-    if (!file.is_open()) {
+    const auto file = engine::Core::Holder{}.instance->getFileSystem().read(path);
+    if (!file.has_value()) {
         spdlog::error("Can't open the given file");
         return false;
     }
-    const auto jsonData = nlohmann::json::parse(file);
+    const auto jsonData = nlohmann::json::parse(file->view());
 
     for (const auto &[name, data] : jsonData.items()) {
         SpellData spell;
 
         try {
             spell.name = name;
-            spell.iconPath = data.at("icon");
+            spell.iconPath = engine::ResourceId::intern(data.at("icon").get<std::string>());
             spell.description = data.at("description");
             spell.cooldown = std::chrono::milliseconds{data.at("cooldown")};
             spell.damage = data.at("damage");
@@ -83,12 +84,12 @@ auto game::SpellDatabase::fromFile(const std::string_view path) -> bool
             spell.scale.x = data.at("scale").at("x");
             spell.scale.y = data.at("scale").at("y");
             spell.lifetime = std::chrono::milliseconds{data.at("lifetime")};
-            spell.audio_on_cast = data.at("audio_on_cast");
-            spell.animation = data.at("animation");
+            spell.audio_on_cast = engine::ResourceId::intern(data.at("audio_on_cast").get<std::string>());
+            spell.animation = engine::ResourceId::intern(data.at("animation").get<std::string>());
             spell.speed = data.at("speed");
             spell.offset_to_source_x = data.at("offset_to_source").at("x");
             spell.offset_to_source_y = data.at("offset_to_source").at("y");
-            spell.effects = data.value("effect", decltype(spell.effects){});
+            spell.effects = resolve(effects.db, data.value("effect", std::vector<std::string>{}), name);
             spell.type = [](const auto &type) {
                 decltype(SpellData{}.type) out;
                 for (const auto &i : type) {
@@ -110,13 +111,24 @@ auto game::SpellDatabase::fromFile(const std::string_view path) -> bool
             }(data.value("target", std::vector<std::string>({"enemy"})));
             spell.quantity = data.value("quantity", 1);
             spell.angle = data.value("angle", 0.0f);
-            spell.on_death = data.value("on_death", "");
+            spell.on_death = Database<SpellData>::npos;
         } catch (nlohmann::json::exception &e) {
             spdlog::error("failed: {}", e.what());
             throw; // we probably don't want to continue
         }
 
-        this->db[name] = spell;
+        this->db.emplace(name, std::move(spell));
+    }
+
+    // note : a spell can refer to any other spell, they are resolved once every spell has an id
+    for (auto &spell : db) {
+        const auto on_death = jsonData.at(spell.name).value("on_death", "");
+        if (on_death.empty()) continue;
+
+        if (const auto id = db.find(on_death); id != Database<SpellData>::npos) {
+            spell.on_death = id;
+        } else
+            UNLIKELY { spdlog::warn("'{}' refers to the unknown spell '{}'. Ignoring", spell.name, on_death); }
     }
 
     return true;
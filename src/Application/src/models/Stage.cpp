@@ -250,7 +250,10 @@ auto game::Stage::create_floor(ThePURGE &game, entt::registry &world, const Para
 
 auto game::Stage::spawn_mob(ThePURGE &game, entt::registry &world, const Parameters &params, const Room &r) -> void
 {
-    for (const auto &[id, density] : params.mobDensity) {
+    for (const auto &[name, density] : params.mobDensity) {
+        const auto id = game.dbEnemies().db.find(name);
+        if (id == Database<Enemy>::npos) continue;
+
         const int isLevelAccepted = static_cast<int>(density);
         if (isLevelAccepted <= levelStage) {
             float newDensity = density - static_cast<float>(static_cast<int>(density));
@@ -260,8 +263,8 @@ auto game::Stage::spawn_mob(ThePURGE &game, entt::registry &world, const Paramet
                 for (auto y = r.y + 1; y < r.y + r.h - 1; ++y) {
                     if (randRange(0, static_cast<int>(1.0f / (newDensity + (0.001f * static_cast<float>(levelStage)))))
                         == 0) {
-                        spdlog::warn("{}", id);
-                        EntityFactory::create(game, world, glm::vec2{x + 0.5, y + 0.5}, game.dbEnemies().db.at(id));
+                        spdlog::warn("{}", name);
+                        EntityFactory::create(game, world, glm::vec2{x + 0.5, y + 0.5}, game.dbEnemies().db[id]);
                     }
                 }
             }
@@ -273,18 +276,17 @@ auto game::Stage::populate_enemies(ThePURGE &game, entt::registry &world, const
 {
     for (const auto &r : regularRooms) spawn_mob(game, world, params, r);
 
-    decltype(game.dbEnemies().db) bosses;
-    std::copy_if(game.dbEnemies().db.begin(), game.dbEnemies().db.end(), std::inserter(bosses, bosses.end()), [](auto &i) {
-        return i.second.is_boss;
-    });
+    std::vector<const Enemy *> bosses;
+    for (const auto &i : game.dbEnemies().db) {
+        if (i.is_boss) bosses.push_back(&i);
+    }
 
-    auto selected_one = bosses.begin();
-    std::advance(selected_one, static_cast<std::size_t>(std::rand()) % bosses.size());
+    const auto selected_one = bosses[static_cast<std::size_t>(std::rand()) % bosses.size()];
 
     spdlog::warn("Adding boss !");
     levelStage++;
 
-    EntityFactory::create(game, world, glm::vec2{boss.x + boss.w * 0.5, boss.y + boss.h * 0.5}, selected_one->second);
+    EntityFactory::create(game, world, glm::vec2{boss.x + boss.w * 0.5, boss.y + boss.h * 0.5}, *selected_one);
 }
 
 auto game::Stage::generate(ThePURGE &game, entt::registry &world, const Parameters &params, std::optional<std::uint32_t> seed)
@@ -312,7 +314,6 @@ auto game::Stage::clear(entt::registry &world, bool kill_the_players) -> void
     world.view<entt::tag<"terrain"_hs>>().each([&](auto &e) { world.destroy(e); });
     world.view<entt::tag<"enemy"_hs>>().each([&](auto &e) { world.destroy(e); });
     world.view<entt::tag<"spell"_hs>>().each([&](auto &e) { world.destroy(e); });
-    world.view<entt::tag<"effect"_hs>>().each([&](auto &e) { world.destroy(e); });
     world.view<entt::tag<"key"_hs>>().each([&](auto &e) { world.destroy(e); });
     if (kill_the_players) {
         levelStage = 1;
@@ -21,7 +21,7 @@ void game::GameHUD::draw(ThePURGE &game, entt::registry &world)
 {
     const auto player = game.player;
 
-    const auto *currentClass = game.dbClasses().getByName(world.get<Classes>(player).ids.back());
+    const auto *currentClass = &game.dbClasses().db[world.get<Classes>(player).ids.back()];
     assert(currentClass != nullptr);
 
     const auto &health = world.get<Health>(player);
@@ -32,37 +32,37 @@ void game::GameHUD::draw(ThePURGE &game, entt::registry &world)
     // clang-format off
 
     static GUITexture staticBackground = {
-        .id =       helper::getTexture("img/hud/hud_static.png"),
+        .texture =  "img/hud/hud_static.png"_rid,
         .topleft =  helper::from1080p(25, 16),
         .size =     helper::from1080p(339, 152)
     };
 
     static GUITexture LB = {
-        .id =       helper::getTexture("img/hud/LB.png"),
+        .texture =  "img/hud/LB.png"_rid,
         .topleft =  helper::from1080p(5, 160),
         .size =     helper::from1080p(30, 22)
     };
 
     static GUITexture LT = {
-        .id =       helper::getTexture("img/hud/LT.png"),
+        .texture =  "img/hud/LT.png"_rid,
         .topleft =  helper::from1080p(80, 160),
         .size =     helper::from1080p(30, 27)
     };
 
     static GUITexture RT = {
-        .id =       helper::getTexture("img/hud/RT.png"),
+        .texture =  "img/hud/RT.png"_rid,
         .topleft =  helper::from1080p(155, 160),
         .size =     helper::from1080p(30, 27)
     };
 
      static GUITexture RB = {
-        .id =       helper::getTexture("img/hud/RB.png"),
+        .texture =  "img/hud/RB.png"_rid,
         .topleft =  helper::from1080p(230, 160),
         .size =     helper::from1080p(30, 22)
     };
 
     static GUITexture UpgradeIcon = {
-        .id =       helper::getTexture("img/hud/UpgradeIcon.png"),
+        .texture =  "img/hud/UpgradeIcon.png"_rid,
         .topleft =  helper::from1080p(337, 125),
         .size =     helper::from1080p(26, 33)
     };
@@ -70,7 +70,7 @@ void game::GameHUD::draw(ThePURGE &game, entt::registry &world)
 // #pragma endregion Static textures
 
     GUITexture portrait = {
-        .id = helper::getTexture(currentClass->iconPath),
+        .texture = currentClass->iconPath,
         .topleft = helper::from1080p(28, 25),
         .size = helper::from1080p(70, 80)};
 
@@ -107,7 +107,7 @@ void game::GameHUD::draw(ThePURGE &game, entt::registry &world)
         if (!spells[i].has_value()) continue;
 
         GUITexture spell{
-            .id = helper::getTexture(game.dbSpells().db.at(std::string(spells[i]->id)).iconPath),
+            .texture = game.dbSpells().db[spells[i]->id].iconPath,
             .topleft = helper::from1080p(spellX[i], 119),
             .size = helper::from1080p(48.0f, 48.0f)};
 
@@ -1,6 +1,7 @@
 #include <spdlog/spdlog.h>
 #include <Engine/audio/Sound.hpp>
 #include <Engine/helpers/Parser.hpp>
+#include <Engine/Core.hpp>
 
 #include "widgets/debug/console/ConsoleCommands.hpp"
 #include "widgets/debug/console/DebugConsole.hpp"
@@ -21,6 +22,7 @@ game::CommandHandler::CommandHandler() :
         {"buyClass", cmd_buyClass},
         {"getClasses", cmd_getClasses},
         {"getClassInfo", cmd_getClassInfo},
+        {"getCacheStats", cmd_getCacheStats},
         {"addHealth", cmd_addHealth},
         //{"giantfireball", cmd_giantfireball},
     }
@@ -67,9 +69,11 @@ game::CommandHandler::handler_t game::CommandHandler::cmd_setSpell =
             if (args.size() != 2) throw std::runtime_error("Wrong argument count");
 
             auto idx = lexicalCast<int>(args[0]);
-            auto spellId = args[1];
+            auto spellId = game.dbSpells().db.find(args[1]);
 
             if (idx < 0 || idx > 4) throw std::runtime_error(fmt::format("Wrong index : {}", args[0]));
+            if (spellId == Database<SpellData>::npos)
+                throw std::runtime_error(fmt::format("No such spell : {}", args[1]));
 
             auto player = game.player;
             auto &spellSlots = world.get<SpellSlots>(player);
@@ -180,7 +184,9 @@ game::CommandHandler::handler_t game::CommandHandler::cmd_getClasses =
             "Player has {} classes : {}",
             classes.size(),
             std::accumulate(
-                std::begin(classes), std::end(classes), std::string{}, [](auto out, auto &i) { return out + ", " + i; }));
+                std::begin(classes), std::end(classes), std::string{}, [&game](auto out, auto &i) {
+                    return out + ", " + game.dbClasses().db.name(i);
+                }));
     };
 
 game::CommandHandler::handler_t game::CommandHandler::cmd_getClassInfo =
@@ -199,10 +205,10 @@ game::CommandHandler::handler_t game::CommandHandler::cmd_getClassInfo =
                         })));
             } else {
                 std::stringstream spellNames;
-                for (const auto &id : data->spells) spellNames << id << ", ";
+                for (const auto &id : data->spells) spellNames << game.dbSpells().db.name(id) << ", ";
 
                 std::stringstream childrenesNames;
-                for (const auto &id : data->children) childrenesNames << game.dbClasses().getByName(id)->name << ", ";
+                for (const auto &id : data->children) childrenesNames << game.dbClasses().db.name(id) << ", ";
 
                 console.info(
                     "Class {} :\n"
@@ -213,8 +219,8 @@ game::CommandHandler::handler_t game::CommandHandler::cmd_getClassInfo =
                     "\tdamage : {}\n"
                     "\tchildren classes : {}",
                     data->name,
-                    data->iconPath,
-                    data->assetGraphPath,
+                    data->iconPath.path(),
+                    data->assetGraphPath.path(),
                     spellNames.str(),
                     data->health,
                     childrenesNames.str());
@@ -225,6 +231,28 @@ game::CommandHandler::handler_t game::CommandHandler::cmd_getClassInfo =
         }
     };
 
+game::CommandHandler::handler_t game::CommandHandler::cmd_getCacheStats =
+    []([[maybe_unused]] entt::registry &world,
+       [[maybe_unused]] ThePURGE &game,
+       std::vector<std::string> &&args,
+       DebugConsole &console) {
+        if (args.size() != 0) throw std::runtime_error("Wrong argument count");
+
+        for (const auto &stats : engine::Core::Holder{}.instance->getCacheStats()) {
+            console.info(
+                "{} : {} entries, {:.2f} MiB, {} hits, {} misses ({:.1f}%), {} loads (average {} us), {} evictions",
+                stats.name,
+                stats.count,
+                static_cast<double>(stats.bytes) / 1048576.0,
+                stats.hits,
+                stats.misses,
+                stats.hitRate() * 100.0,
+                stats.loads,
+                stats.averageLoad().count(),
+                stats.evictions);
+        }
+    };
+
 game::CommandHandler::handler_t game::CommandHandler::cmd_giantfireball =
     [](entt::registry &, ThePURGE &, std::vector<std::string> &&, DebugConsole &) {
         // SpellFactory::create(SpellFactory::DEBUG_GIANT_FIREBALL, world, game.player, glm::vec2(0, 0));
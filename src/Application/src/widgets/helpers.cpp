@@ -8,13 +8,9 @@
 
 namespace game::helper {
 
-auto getTexture(const std::string &simplePath) -> std::uint32_t
+auto getTexture(const engine::ResourceId &simplePath) -> std::uint32_t
 {
-    static auto holder = engine::Core::Holder{};
-
-    const auto &dataFolder = holder.instance->settings().data_folder;
-
-    return engine::helper::loadTexture(dataFolder + simplePath);
+    return engine::helper::loadTexture(simplePath);
 }
 
 auto from1080p(float x, float y) noexcept -> ImVec2 { return ImVec2{x / 1920.0f, y / 1080.0f}; }
@@ -31,7 +27,15 @@ void drawTexture(std::uint32_t id, ImVec2 topLeft, ImVec2 size, ImVec4 tintColor
     ImGui::Image(reinterpret_cast<void *>(static_cast<intptr_t>(id)), size, ImVec2(0, 0), ImVec2(1, 1),  tintColor);
 }
 
-void drawTexture(const GUITexture &t, ImVec4 tintColor) noexcept { drawTexture(t.id, frac2pixel(t.topleft), frac2pixel(t.size), tintColor); }
+void drawTexture(const engine::ResourceId &texture, ImVec2 topLeft, ImVec2 size, ImVec4 tintColor)
+{
+    drawTexture(getTexture(texture), topLeft, size, tintColor);
+}
+
+void drawTexture(const GUITexture &t, ImVec4 tintColor)
+{
+    drawTexture(t.texture, frac2pixel(t.topleft), frac2pixel(t.size), tintColor);
+}
 
 void drawText(ImVec2 pos, const std::string &str, ImVec4 color, ImFont *font) noexcept
 {
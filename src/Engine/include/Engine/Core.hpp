@@ -8,8 +8,6 @@
 #include <entt/entt.hpp>
 #include <glm/matrix.hpp>
 
-#include "Engine/resources/LoaderColor.hpp"
-#include "Engine/resources/LoaderVBOTexture.hpp"
 #include "Engine/resources/LoaderTexture.hpp"
 
 #include "Engine/Event/Event.hpp"
@@ -26,7 +24,14 @@ class Game;
 
 class Window;
 class JoystickManager;
-class Shader;
+class Renderer;
+class FramePacer;
+class AssetLoader;
+class FileSystem;
+class TaskGraph;
+class AssetCache;
+class ParticleSystem;
+class DebugDraw;
 class AudioManager;
 struct Settings;
 
@@ -109,13 +114,31 @@ public:
 
     [[nodiscard]] auto isRunning() const noexcept -> bool { return m_is_running; }
 
-    template<typename T>
-    auto getCache() noexcept -> entt::resource_cache<T> &;
+    auto getTextures() noexcept -> CacheTexture & { return m_textures; }
+
+    // note : the statistics of every resource cache of the engine
+    [[nodiscard]] auto getCacheStats() const -> std::vector<CacheStats>;
+
+    auto getAssetLoader() noexcept -> AssetLoader & { return *m_loader; }
+
+    // note : only during api::Game::onCreate, the steps are run right after it
+    auto getStartup() noexcept -> TaskGraph & { return *m_startup; }
+
+    auto getFileSystem() noexcept -> const FileSystem & { return *m_filesystem; }
+
+    auto getAssetCache() noexcept -> const AssetCache & { return *m_asset_cache; }
 
     auto getAudioManager() noexcept -> AudioManager & { return m_audioManager; }
 
     auto getWorld() noexcept -> entt::registry & { return m_world; }
 
+    auto getFramePacer() noexcept -> FramePacer & { return *m_pacer; }
+
+    auto getParticleSystem() noexcept -> ParticleSystem & { return *m_particles; }
+
+    // note : the shapes are drawn with the next frame, then forgotten
+    auto getDebugDraw() noexcept -> DebugDraw & { return *m_debug_draw; }
+
     auto settings() const noexcept -> const Settings & { return m_settings; }
 
 #ifndef NDEBUG
@@ -154,33 +177,44 @@ private:
 
     std::unique_ptr<JoystickManager> m_joystickManager;
 
-    entt::resource_cache<Color> m_colors;
-    entt::resource_cache<VBOTexture> m_vbo_textures;
-    entt::resource_cache<Texture> m_textures;
+    std::unique_ptr<FileSystem> m_filesystem;
+
+    std::unique_ptr<AssetCache> m_asset_cache;
 
-    std::unique_ptr<Shader> m_shader_colored;
-    std::unique_ptr<Shader> m_shader_colored_textured;
+    CacheTexture m_textures{"textures"};
+
+    std::unique_ptr<AssetLoader> m_loader;
+
+    std::unique_ptr<FramePacer> m_pacer;
+
+    std::unique_ptr<Renderer> m_renderer;
+
+    std::unique_ptr<TaskGraph> m_startup;
+
+    // note : state given to the renderer with each snapshot
+    glm::mat4 m_view_proj{1.0f};
+    bool m_shake{false};
+    float m_time{0.0f};
+
+    std::unique_ptr<ParticleSystem> m_particles;
+
+    std::unique_ptr<DebugDraw> m_debug_draw;
 
     AudioManager m_audioManager;
 
 #ifndef NDEBUG
     bool m_show_debug_info = false;
+    bool m_show_hitboxes = false;
 
     auto debugDrawJoystick() -> void;
     auto debugDrawDisplayOptions() -> void;
+    auto debugDrawFramePacing() -> void;
+    auto debugDrawCaches() -> void;
 #endif
 
     std::uint32_t m_displayMode = 4; // note : = GL_TRIANGLES
 };
 
-template<>
-auto Core::getCache() noexcept -> entt::resource_cache<Color> &;
-
-template<>
-auto Core::getCache() noexcept -> entt::resource_cache<VBOTexture> &;
-
-template<>
-auto Core::getCache() noexcept -> entt::resource_cache<Texture> &;
 
 } // namespace engine
 
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+namespace engine {
+
+// note : immediate mode debug shapes, collected during the frame and drawn as lines
+//        in a single draw call on top of everything else // see @Renderer
+class DebugDraw {
+public:
+    // note : x, y, r, g, b, a
+    static constexpr std::size_t VERTEX_STRIDE = 6;
+
+    auto line(const glm::vec2 &from, const glm::vec2 &to, const glm::vec4 &color) -> void;
+
+    // note : centred on the position, like an hitbox // see @HitboxT
+    auto rectangle(const glm::vec2 &center, const glm::vec2 &size, const glm::vec4 &color) -> void;
+
+    auto circle(const glm::vec2 &center, float radius, const glm::vec4 &color, std::uint32_t segments = 24) -> void;
+
+    // note : give the vertices of the frame and start a new one, return the number of vertices
+    auto write(std::vector<float> &vertices) -> std::size_t;
+
+    auto clear() noexcept -> void { m_vertices.clear(); }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_vertices.size() / VERTEX_STRIDE; }
+
+private:
+    auto vertex(const glm::vec2 &position, const glm::vec4 &color) -> void;
+
+    std::vector<float> m_vertices;
+};
+
+} // namespace engine
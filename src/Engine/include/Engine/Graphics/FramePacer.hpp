@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+namespace engine {
+
+// note : decide when a frame starts and measure the delay between an input and the present of its frame
+//        VSYNC    the swap blocks on the display refresh
+//        UNCAPPED no wait at all
+//        CAPPED   no vsync, the frame waits for its deadline by sleeping then spinning the last moment
+class FramePacer {
+public:
+    using clock = std::chrono::steady_clock;
+
+    enum class Mode {
+        VSYNC,
+        UNCAPPED,
+        CAPPED,
+    };
+
+    struct Config {
+        Mode mode{Mode::VSYNC};
+        std::uint32_t fps{60};   // only used by the capped mode
+        bool late_latch{false}; // poll the input again right before the simulation
+    };
+
+    struct Stats {
+        float frame_ms{0.0f};
+        float latency_last_ms{0.0f};
+        float latency_average_ms{0.0f};
+        float latency_max_ms{0.0f};
+        std::uint64_t samples{0};
+    };
+
+    explicit FramePacer(Config &&config);
+
+    static auto parse(const std::string_view mode) -> Mode;
+
+    [[nodiscard]] auto getConfig() const noexcept -> const Config & { return m_config; }
+
+    [[nodiscard]] auto getSwapInterval() const noexcept -> int { return m_config.mode == Mode::VSYNC ? 1 : 0; }
+
+    // note : block until the next frame may start, return true if it had to wait
+    auto wait() -> bool;
+
+    // note : the frame starts now, the deadline of the next one is scheduled
+    auto beginFrame() -> void;
+
+    // note : an input has been polled at this time, only the oldest one not presented yet is kept
+    auto onInput(clock::time_point polled) -> void;
+
+    // note : give the input handled by the frame being built
+    auto takeInput() -> std::optional<clock::time_point>;
+
+    // note : thread safe, called by the renderer once the frame is presented
+    auto onPresent(std::optional<clock::time_point> input) -> void;
+
+    [[nodiscard]] auto getStats() const -> Stats;
+
+private:
+    Config m_config;
+
+    clock::duration m_period;
+    clock::time_point m_deadline;
+
+    // note : adjusted to the precision of the sleep observed on this machine
+    clock::duration m_sleep_margin;
+
+    std::optional<clock::time_point> m_input;
+
+    mutable std::mutex m_mutex;
+    Stats m_stats;
+    std::optional<clock::time_point> m_last_present;
+};
+
+} // namespace engine
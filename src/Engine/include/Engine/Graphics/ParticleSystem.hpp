@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+namespace engine {
+
+// note : the particles are not entities, they live in fixed size pools (one array per field)
+//        updated in a single pass and drawn with one instanced draw call // see @Renderer
+class ParticleSystem {
+public:
+    static constexpr std::size_t CAPACITY = 4096;
+
+    // note : x, y, z, size, r, g, b, a
+    static constexpr std::size_t INSTANCE_STRIDE = 8;
+
+    struct Particle {
+        glm::vec3 position;
+        glm::vec2 velocity;   // unit per second
+        glm::vec4 color;
+        glm::vec4 fade{0.0f}; // color change per millisecond
+        float jitter{0.0f};   // random velocity change per millisecond
+        float size{0.1f};
+        float lifetime{300.0f}; // millisecond
+    };
+
+    ParticleSystem();
+
+    // note : return false if the pool is full, the particle is dropped
+    auto emit(const Particle &) noexcept -> bool;
+
+    auto update(float elapsed_ms) noexcept -> void;
+
+    // note : write the instance data of the alive particles, return how many were written
+    auto write(std::vector<float> &instances) const -> std::size_t;
+
+    auto clear() noexcept -> void { m_count = 0; }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_count; }
+
+private:
+    enum Field {
+        X,
+        Y,
+        Z,
+        VX,
+        VY,
+        SIZE,
+        R,
+        G,
+        B,
+        A,
+        DR,
+        DG,
+        DB,
+        DA,
+        JITTER,
+        LIFE,
+
+        FIELD_MAX
+    };
+
+    std::array<std::vector<float>, FIELD_MAX> m_pool;
+    std::size_t m_count{0};
+    std::uint32_t m_tick{0};
+};
+
+} // namespace engine
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <optional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+
+struct ImDrawData;
+struct ImDrawList;
+
+namespace engine {
+
+// note : everything the renderer needs to draw one frame, filled by the simulation
+//        and never touched again until the renderer is done with it // see @Renderer
+struct RenderSnapshot {
+    struct Sprite {
+        glm::mat4 model;
+        glm::vec4 color;
+        glm::vec4 clip;
+        std::uint32_t texture; // note : OpenGL name, 0 for an untextured sprite
+        bool mirrored;
+    };
+
+    glm::ivec2 viewport{0, 0};
+    glm::vec4 background{0.0f, 0.0f, 0.0f, 1.0f};
+    glm::mat4 view_proj{1.0f};
+    bool shake{false};
+    float time{0.0f};
+    std::uint32_t display_mode{4}; // note : = GL_TRIANGLES
+
+    std::vector<Sprite> colored;
+    std::vector<Sprite> textured;
+
+    std::vector<float> particles;
+    std::size_t particle_count{0};
+
+    // note : vertices of the debug lines // see @DebugDraw
+    std::vector<float> debug_lines;
+    std::size_t debug_vertex_count{0};
+
+    // note : deep copy of the ImGui draw lists, ImGui reuses its own on the next frame
+    std::unique_ptr<ImDrawData> ui;
+    std::vector<ImDrawList *> ui_lists;
+
+    // note : oldest input handled by this frame, to measure the delay until it is presented
+    std::optional<std::chrono::steady_clock::time_point> input;
+
+    // note : GLsync, the resources created by the simulation before it are visible to the renderer
+    void *fence{nullptr};
+
+    RenderSnapshot();
+    ~RenderSnapshot();
+
+    RenderSnapshot(const RenderSnapshot &) = delete;
+    RenderSnapshot &operator=(const RenderSnapshot &) = delete;
+
+    auto clear() -> void;
+
+    auto setUserInterface(const ImDrawData *data) -> void;
+};
+
+} // namespace engine
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "Engine/Graphics/RenderSnapshot.hpp"
+
+namespace engine {
+
+class Window;
+class Shader;
+class FramePacer;
+
+// note : the simulation fills a snapshot (acquire) and hands it over (submit)
+//        with a render thread, the thread owns the OpenGL context of the window and draws the snapshot
+//        while the simulation already works on the next one, otherwise the snapshot is drawn right away
+class Renderer {
+public:
+    Renderer(Window &window, FramePacer &pacer, const std::string &data_folder, bool threaded);
+    ~Renderer();
+
+    Renderer(const Renderer &) = delete;
+    Renderer &operator=(const Renderer &) = delete;
+
+    // note : the returned snapshot is cleared
+    auto acquire() -> RenderSnapshot &;
+
+    auto submit() -> void;
+
+    [[nodiscard]] auto isThreaded() const noexcept -> bool { return m_threaded; }
+
+private:
+    auto draw(RenderSnapshot &) -> void;
+
+    // note : vertex arrays are not shared between contexts, they are created by the thread drawing
+    auto createVertexArrays() -> void;
+
+    auto deleteVertexArrays() -> void;
+
+    Window &m_window;
+    FramePacer &m_pacer;
+    bool m_threaded;
+
+    std::unique_ptr<Shader> m_shader_colored;
+    std::unique_ptr<Shader> m_shader_colored_textured;
+    std::unique_ptr<Shader> m_shader_particle;
+    std::unique_ptr<Shader> m_shader_debug;
+
+    std::uint32_t m_quad_VAO{0};
+    std::uint32_t m_quad_VBO{0};
+    std::uint32_t m_quad_EBO{0};
+
+    std::uint32_t m_particle_VAO{0};
+    std::uint32_t m_particle_VBO{0};
+
+    std::uint32_t m_debug_VAO{0};
+    std::uint32_t m_debug_VBO{0};
+
+    std::array<RenderSnapshot, 2> m_snapshots;
+    std::size_t m_write{0};
+    std::optional<std::size_t> m_pending;
+    std::optional<std::size_t> m_drawing;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop{false};
+    std::thread m_thread;
+};
+
+} // namespace engine
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace engine {
+
+// note : the pixels are read into a ring of pixel buffer objects, mapped a few frames later
+//        and encoded by a pool of worker threads, so a capture does not stall the frame
+class ScreenCapture {
+public:
+    enum class Format {
+        PNG,
+        RAW, // note : RGBA8, top to bottom, no header
+    };
+
+    struct Config {
+        std::uint32_t every{0};     // capture one frame every N frames, 0 to disable the recording
+        Format format{Format::PNG}; // format of the recorded frames, a screenshot is always a png
+        std::size_t queue{8};       // frames waiting to be encoded before the frame blocks
+        std::size_t threads{1};     // encoder threads
+        std::string folder;         // where the recorded frames are written
+    };
+
+    explicit ScreenCapture(Config &&config);
+    ~ScreenCapture();
+
+    ScreenCapture(const ScreenCapture &) = delete;
+    ScreenCapture &operator=(const ScreenCapture &) = delete;
+
+    // queue a capture, it will be read back at the end of the next frame
+    auto request(const std::string_view filename) -> void;
+
+    // must be called once per frame, after the draw and before the swap
+    auto update() -> void;
+
+    // block until every pending capture is written on disk
+    // the captures requested since the last update are taken from the frame on screen
+    auto flush() -> void;
+
+    [[nodiscard]] auto isRecording() const noexcept -> bool { return m_config.every != 0; }
+
+private:
+    // note : number of frames before forcing the map of a readback
+    static constexpr std::uint64_t kMaxLatency = 2;
+    static constexpr std::size_t kRingSize = kMaxLatency + 1;
+
+    struct Readback {
+        std::uint32_t pbo;
+        void *fence; // note : GLsync
+        std::int32_t width;
+        std::int32_t height;
+        std::string filename;
+        Format format;
+        std::uint64_t frame;
+    };
+
+    struct Job {
+        std::vector<std::uint8_t> pixels;
+        std::int32_t width;
+        std::int32_t height;
+        std::string filename;
+        Format format;
+    };
+
+    // note : buffer is GL_BACK for the frame being drawn, or GL_FRONT for the frame on screen
+    auto readback(std::string &&filename, Format, std::uint32_t buffer) -> void;
+
+    auto map(Readback &, bool wait) -> bool;
+
+    auto push(Job &&) -> void;
+
+    static auto encode(Job &&) -> void;
+
+    Config m_config;
+
+    std::uint64_t m_frame{0};
+
+    // note : the requests come from the simulation, the readbacks are done by the renderer
+    std::mutex m_requests_mutex;
+    std::vector<std::string> m_requests;
+
+    std::vector<std::uint32_t> m_ring;
+    std::size_t m_ring_next{0};
+    std::deque<Readback> m_pending;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Job> m_jobs;
+    std::size_t m_encoding{0};
+    bool m_stop{false};
+    std::vector<std::thread> m_workers;
+};
+
+} // namespace engine
@@ -4,6 +4,7 @@
 
 #include <string_view>
 
+#include <glm/vec4.hpp>
 #include <glm/ext/matrix_float4x4.hpp>
 
 namespace engine {
@@ -36,6 +37,9 @@ auto Shader::setUniform(const std::string_view, bool) -> void;
 template<>
 auto Shader::setUniform(const std::string_view, float) -> void;
 
+template<>
+auto Shader::setUniform(const std::string_view, glm::vec4) -> void;
+
 template<>
 auto Shader::setUniform(const std::string_view, glm::mat4) -> void;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <glm/vec2.hpp>
 
@@ -11,6 +12,8 @@ struct ImGuiContext;
 
 namespace engine {
 
+class ScreenCapture;
+
 class Window {
 public:
     enum Property {
@@ -28,10 +31,14 @@ public:
 
     auto close() -> void;
 
+    // note : must be called on the thread owning the context of the window, after the draw
     auto render() -> void;
 
     auto setActive() -> void;
 
+    // note : only available with the render thread, the shared context used by the simulation
+    auto setLoaderActive() -> void;
+
     auto setSize(glm::ivec2 &&size) -> void;
 
     auto setPosition(glm::ivec2 &&pos) -> void;
@@ -43,14 +50,16 @@ public:
 
     auto getSize() const -> glm::dvec2 { return m_size; }
 
+    auto getFramebufferSize() const -> glm::ivec2;
+
 
     template<typename EventType>
     auto applyEvent([[maybe_unused]] const EventType &) -> void
     {
     }
 
-    // note : just an utility function : may not stay
-    auto draw(const std::function<void()> &drawer) -> void;
+    // note : start the user interface frame, ImGui::Render must be called before the draw data is used
+    auto newFrame() -> void;
 
     auto getNextEvent() -> std::optional<Event>;
 
@@ -58,7 +67,8 @@ public:
 
     auto setFullscreen(bool fullscreen) -> void;
 
-    bool screenshot(const std::string_view filename);
+    // note : the capture is asynchronous, the file is written a few frames later
+    auto screenshot(const std::string_view filename) -> void;
 
     void setCursorVisible(bool visible) noexcept;
 
@@ -70,8 +80,11 @@ private:
 
     ::GLFWmonitor *m_monitor{nullptr};
     ::GLFWwindow *m_handle{nullptr};
+    ::GLFWwindow *m_loader_handle{nullptr};
     ::ImGuiContext *m_ui_context{nullptr};
 
+    std::unique_ptr<ScreenCapture> m_capture;
+
     std::vector<Event> m_events;
 
     static auto callback_eventClose(GLFWwindow *window) -> void;
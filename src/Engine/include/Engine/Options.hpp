@@ -31,6 +31,7 @@ struct Options {
     static constexpr auto DEFAULT_DATA_FOLDER = "data/";
     static constexpr auto DEFAULT_OUTPUT_FOLDER = "../generated/";
     static constexpr auto DEFAULT_CONFIG = "data/config/app.ini";
+    static constexpr auto DEFAULT_PACK = "data.pack";
 
     enum Value {
         CONFIG_PATH,
@@ -38,11 +39,34 @@ struct Options {
         REPLAY_DATA,
         DATA_FOLDER,
         OUTPUT_FOLDER,
+        PACK,
 
         FULLSCREEN,
         WINDOW_WIDTH,
         WINDOW_HEIGHT,
 
+        CAPTURE_EVERY,
+        CAPTURE_FORMAT,
+        CAPTURE_QUEUE,
+        CAPTURE_THREADS,
+
+        RENDER_THREAD,
+
+        FRAME_PACING,
+        FRAME_CAP,
+        LATE_LATCH,
+
+        LOADER_THREADS,
+        UPLOAD_BUDGET,
+        TEXTURE_BUDGET,
+
+        ASSET_CACHE,
+        CACHE_MIPMAPS,
+
+        AUDIO_BACKEND,
+        AUDIO_VOICES,
+        AUDIO_THREAD,
+
         OPTION_MAX
     };
 
@@ -71,6 +95,59 @@ struct Options {
         options[REPLAY_DATA] = app.add_option("--replay-data", settings.replay_data, "Json events to replay.");
         options[DATA_FOLDER] = app.add_option("--data", settings.data_folder, "Path of the data folder.", true);
         options[OUTPUT_FOLDER] = app.add_option("--output-folder", settings.output_folder, "Path of the generated output.", true);
+        options[PACK] =
+            app.add_option("--pack", settings.pack, "Asset pack read before the data folder, see engine_pack.", true);
+
+        options[CAPTURE_EVERY] = app.add_option(
+            "--capture-every", settings.capture_every, "Record one frame every N frames, 0 to disable.", true);
+        options[CAPTURE_FORMAT] =
+            app.add_option("--capture-format", settings.capture_format, "Format of the recorded frames.", true)
+                ->check(CLI::IsMember({"png", "raw"}));
+        options[CAPTURE_QUEUE] = app.add_option(
+            "--capture-queue", settings.capture_queue, "Recorded frames waiting to be encoded before blocking.", true);
+        options[CAPTURE_THREADS] =
+            app.add_option("--capture-threads", settings.capture_threads, "Threads encoding the recorded frames.", true);
+
+        options[RENDER_THREAD] = app.add_option(
+            "--render-thread", settings.render_thread, "Draw the frames on a dedicated thread.", true);
+
+        options[FRAME_PACING] =
+            app.add_option("--frame-pacing", settings.frame_pacing, "When a frame starts: vsync, uncapped or capped.", true)
+                ->check(CLI::IsMember({"vsync", "uncapped", "capped"}));
+        options[FRAME_CAP] =
+            app.add_option("--frame-cap", settings.frame_cap, "Frames per second of the capped frame pacing.", true);
+        options[LATE_LATCH] = app.add_option(
+            "--late-latch", settings.late_latch, "Poll the input again right before the simulation.", true);
+
+        options[LOADER_THREADS] =
+            app.add_option("--loader-threads", settings.loader_threads, "Threads decoding the assets.", true);
+        options[UPLOAD_BUDGET] = app.add_option(
+            "--upload-budget", settings.upload_budget, "Microseconds per frame spent uploading the decoded assets.", true);
+        options[TEXTURE_BUDGET] = app.add_option(
+            "--texture-budget",
+            settings.texture_budget,
+            "Megabytes of video memory kept by the textures, 0 for no limit.",
+            true);
+
+        options[ASSET_CACHE] = app.add_option(
+            "--asset-cache",
+            settings.asset_cache,
+            "Keep the decoded textures, the spritesheets and the shader binaries in the output folder.",
+            true);
+        options[CACHE_MIPMAPS] = app.add_option(
+            "--cache-mipmaps", settings.cache_mipmaps, "Store the mipmaps of the textures in the asset cache.", true);
+
+        options[AUDIO_BACKEND] =
+            app.add_option(
+                   "--audio-backend",
+                   settings.audio_backend,
+                   "Who plays the sounds: openal, null or wav, the last two are mixed in software.",
+                   true)
+                ->check(CLI::IsMember({"openal", "null", "wav"}));
+        options[AUDIO_VOICES] =
+            app.add_option("--audio-voices", settings.audio_voices, "Sounds played at the same time.", true);
+        options[AUDIO_THREAD] = app.add_option(
+            "--audio-thread", settings.audio_thread, "Talk to the audio driver from a dedicated thread.", true);
 
         if (const auto res = [&]() -> std::optional<int> {
                 CLI11_PARSE(app, argc, argv);
@@ -90,6 +167,7 @@ struct Options {
             settings.data_folder = options[Options::DATA_FOLDER]->as<std::string>();
         if (!options[Options::OUTPUT_FOLDER]->empty())
             settings.output_folder = options[Options::OUTPUT_FOLDER]->as<std::string>();
+        if (!options[Options::PACK]->empty()) settings.pack = options[Options::PACK]->as<std::string>();
     }
 
     auto dump() const -> void
@@ -115,9 +193,26 @@ struct Options {
         .replay_data = "",
         .data_folder = DEFAULT_DATA_FOLDER,
         .output_folder = DEFAULT_OUTPUT_FOLDER,
+        .pack = DEFAULT_PACK,
         .fullscreen = true,
         .window_width = 1024,
-        .window_height = 768
+        .window_height = 768,
+        .capture_every = 0,
+        .capture_format = "png",
+        .capture_queue = 8,
+        .capture_threads = 1,
+        .render_thread = false,
+        .frame_pacing = "vsync",
+        .frame_cap = 60,
+        .late_latch = false,
+        .loader_threads = 2,
+        .upload_budget = 2000,
+        .texture_budget = 256,
+        .asset_cache = true,
+        .cache_mipmaps = true,
+        .audio_backend = "openal",
+        .audio_voices = 32,
+        .audio_thread = true
     };
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace engine {
@@ -11,10 +12,33 @@ struct Settings {
     std::string replay_data;
     std::string data_folder;
     std::string output_folder;
+    std::string pack;
 
     bool fullscreen;
     std::uint16_t window_width;
     std::uint16_t window_height;
+
+    std::uint32_t capture_every;
+    std::string capture_format;
+    std::uint32_t capture_queue;
+    std::uint32_t capture_threads;
+
+    bool render_thread;
+
+    std::string frame_pacing;
+    std::uint32_t frame_cap;
+    bool late_latch;
+
+    std::uint32_t loader_threads;
+    std::uint32_t upload_budget;
+    std::uint32_t texture_budget;
+
+    bool asset_cache;
+    bool cache_mipmaps;
+
+    std::string audio_backend;
+    std::uint32_t audio_voices;
+    bool audio_thread;
 };
 
 } // namespace engine
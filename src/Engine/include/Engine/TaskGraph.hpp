@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine {
+
+// note : steps run once each, as soon as the steps they depend on are done
+//        a step can only depend on the steps added before it, so the graph has no cycle
+//        the OpenGL / OpenAL work is tagged MAIN_THREAD, these steps run on the caller of @TaskGraph::run
+//        in the order they have been added
+class TaskGraph {
+public:
+    using clock = std::chrono::steady_clock;
+
+    using Id = std::size_t;
+
+    enum Affinity {
+        ANY,
+        MAIN_THREAD,
+
+        AFFINITY_MAX
+    };
+
+    auto add(std::string_view name, std::function<void()> &&work, std::vector<Id> &&after = {}, Affinity = ANY)
+        -> Id;
+
+    // note : block until every step is done, the steps not started yet are skipped once one of them throws
+    //        the first exception is then rethrown
+    auto run(std::size_t threads) -> void;
+
+    // note : the start and the duration of each step, relative to the start of the run
+    auto report() const -> void;
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return m_tasks.empty(); }
+
+private:
+    struct Task {
+        std::string name;
+        std::function<void()> work;
+        std::vector<Id> after;
+        Affinity affinity;
+
+        // note : filled by @TaskGraph::run
+        std::vector<Id> next{};
+        std::size_t waiting{0};
+        clock::time_point start{};
+        clock::time_point end{};
+    };
+
+    std::vector<Task> m_tasks;
+
+    clock::time_point m_start;
+    clock::time_point m_end;
+    std::size_t m_threads{0};
+};
+
+} // namespace engine
@@ -16,6 +16,7 @@ public:
 
     /**
      * function called when the game is created
+     * the slow steps are added to Core::getStartup to run at the same time, they are done before the first frame
      */
     virtual auto onCreate(entt::registry &) -> void = 0;
 
@@ -1,20 +1,59 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 #include <AL/al.h>
 
+#include "Engine/audio/SoftwareMixer.hpp"
+#include "Engine/resources/FileSystem.hpp"
+
 namespace engine {
 
 class AudioFileBuffer {
 public:
-    explicit AudioFileBuffer(const std::string_view path);
+    // note : the samples of a file, no OpenAL call is needed to build it so it can be done on any thread
+    //        the samples are a view on the mapped file, given as is to OpenAL
+    struct Pcm {
+        FileSystem::File file;
+        std::string_view data;
+        ALenum format;
+        ALsizei sample_rate;
+
+        static auto decode(const std::string_view path) -> Pcm;
+    };
+
+    // note : throw if OpenAL can not play this format
+    static auto format(std::uint8_t channels, std::uint8_t bitsPerSample) -> ALenum;
+
+    // note : the format is one given by @AudioFileBuffer::format, the memory of the clip is reused
+    static auto convert(ALenum format, std::string_view data, ALsizei sampleRate, SoftwareMixer::Clip &clip) -> void;
+
+    // note : software, the samples are converted for the @SoftwareMixer instead of being given to OpenAL
+    explicit AudioFileBuffer(const std::string_view path, bool software = false);
+    explicit AudioFileBuffer(const Pcm &pcm, bool software = false);
     ~AudioFileBuffer();
 
+    AudioFileBuffer(const AudioFileBuffer &) = delete;
+    AudioFileBuffer &operator=(const AudioFileBuffer &) = delete;
+
     constexpr
     auto get() const noexcept -> ALuint { return m_buffer; }
 
+    // note : nullptr if the samples have been given to OpenAL
+    [[nodiscard]] auto clip() const noexcept -> const SoftwareMixer::Clip *
+    {
+        return m_clip.has_value() ? &m_clip.value() : nullptr;
+    }
+
+    // note : the bytes given to OpenAL or kept for the mixer
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
 private:
-    ALuint m_buffer;
+    ALuint m_buffer{0};
+    std::optional<SoftwareMixer::Clip> m_clip;
+    std::size_t m_size;
 };
 
 } // namespace engine
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <string>
@@ -8,28 +9,69 @@
 #include <AL/alc.h>
 
 #include "Sound.hpp"
+#include "MusicStream.hpp"
+#include "VoicePool.hpp"
+#include "AudioThread.hpp"
+#include "SoundEvents.hpp"
 #include "Engine/resources/AudioFileLoader.hpp"
+#include "Engine/resources/ResourceId.hpp"
 
 namespace engine {
 
 class AudioManager {
 public:
-    AudioManager();
+    struct Config {
+        std::string backend; // note : openal, null or wav
+        std::size_t voices;
+        std::string wav; // note : the file written by the wav backend
+        bool threaded;   // note : see @AudioThread
+    };
+
+    AudioManager() = default;
 
     ~AudioManager();
 
-    // Only supports WAV
-    auto getSound(const std::string &path) -> std::shared_ptr<Sound>;
+    // note : silent until opened, the voices are mixed in software when there is no audio device
+    auto open(const Config &config) -> void;
 
-private:
-    void garbageCollectCurrentSounds();
+    // Only supports WAV, the path is relative to the data folder
+    // note : silent if every voice is busy with a higher priority, see @VoicePool
+    auto getSound(const ResourceId &path, SoundPriority priority = SoundPriority::NORMAL) -> Sound;
+
+    // note : the sounds requested many times per frame, played by @AudioManager::update, see @SoundEvents
+    [[nodiscard]] auto events() noexcept -> SoundEvents & { return m_events; }
+
+    // note : streamed from the file, see @MusicStream, the stream is released with its last reference
+    //        played by OpenAL, or by the software mixer without device
+    auto getMusic(const ResourceId &path) -> std::shared_ptr<MusicStream>;
+
+    [[nodiscard]] auto contains(entt::id_type id) const -> bool;
+
+    // note : upload a sound decoded in the background // see @AssetLoader
+    auto addSound(entt::id_type id, const AudioFileBuffer::Pcm &pcm) -> void;
+
+    [[nodiscard]] auto stats() const -> CacheStats { return m_audioFileCache.stats(); }
+
+    // note : once per frame, the software mixer mixes the time elapsed
+    //        nothing waits for the audio driver, the commands of the frame are posted to the @AudioThread
+    auto update(std::chrono::nanoseconds elapsed) -> void;
+
+    // note : nullptr if not opened
+    [[nodiscard]] auto voices() const noexcept -> const VoicePool * { return m_voices.get(); }
 
 private:
-    ALCdevice *m_device;
-    ALCcontext *m_context;
+    ALCdevice *m_device{nullptr};
+    ALCcontext *m_context{nullptr};
+
+    bool m_software{false};
+    std::unique_ptr<AudioThread> m_audio;
+    std::unique_ptr<VoicePool> m_voices;
+
+    SoundEvents m_events;
 
-    std::vector<std::shared_ptr<engine::Sound>> m_currentSounds;
-    AudioFileCache m_audioFileCache;
+    // note : the audio thread only keeps a pointer, the last reference is handed over to it
+    std::vector<std::shared_ptr<MusicStream>> m_streams;
+    AudioFileCache m_audioFileCache{"sounds"};
 };
 
 } // namespace engine
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <AL/al.h>
+#include <entt/entt.hpp>
+
+#include "Engine/audio/VoicePool.hpp"
+#include "Engine/audio/SoftwareMixer.hpp"
+#include "Engine/helpers/SpscQueue.hpp"
+
+namespace engine {
+
+class AudioFileBuffer;
+class MusicStream;
+
+// note : the only thread talking to OpenAL, or running the @SoftwareMixer, once the voices are created
+//        the game thread posts commands without waiting and reads back the state of the voices from a snapshot
+//        without a thread, the commands are executed by @AudioThread::flush
+class AudioThread {
+public:
+    // note : commands waiting to be executed, the game thread only waits when they are all in use
+    static constexpr std::size_t QUEUE = 4096;
+
+    // note : between two wakes of the thread, the latency of a command
+    static constexpr std::chrono::milliseconds PERIOD{4};
+
+    struct VoiceCommand {
+        VoicePool::Index voice;
+        std::uint32_t sequence; // note : echoed by the snapshot once applied
+    };
+
+    // note : the buffer is kept alive until the voice is released or assigned again
+    struct Assign : VoiceCommand {
+        entt::resource_handle<AudioFileBuffer> buffer;
+    };
+    struct Play : VoiceCommand {
+    };
+    struct Stop : VoiceCommand {
+    };
+    struct SetPitch : VoiceCommand {
+        float pitch;
+    };
+    struct SetGain : VoiceCommand {
+        float gain;
+    };
+    struct SetLoop : VoiceCommand {
+        bool loop;
+    };
+    struct Release : VoiceCommand {
+    };
+
+    // note : the time mixed by the @SoftwareMixer
+    struct Advance {
+        std::chrono::nanoseconds elapsed;
+    };
+
+    struct AddStream {
+        MusicStream *stream;
+    };
+    // note : the last reference, the stream is closed by the audio thread
+    struct RemoveStream {
+        std::shared_ptr<MusicStream> stream;
+    };
+
+    using Command = std::variant<
+        std::monostate,
+        Assign,
+        Play,
+        Stop,
+        SetPitch,
+        SetGain,
+        SetLoop,
+        Release,
+        Advance,
+        AddStream,
+        RemoveStream>;
+
+    // note : without a mixer, requires the current AL context, less voices are created if the device has less sources
+    AudioThread(std::size_t capacity, std::unique_ptr<SoftwareMixer> mixer, bool threaded);
+    ~AudioThread();
+
+    AudioThread(const AudioThread &) = delete;
+    AudioThread &operator=(const AudioThread &) = delete;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_voices.size(); }
+
+    // note : game thread only
+    auto post(Command &&command) -> void;
+
+    // note : game thread only, once per frame, executes the commands when there is no thread
+    auto flush() -> void;
+
+    struct State {
+        SoundStatus status;
+        std::uint32_t sequence; // note : of the last command applied to the voice
+    };
+
+    // note : any thread, the state of the voice when the audio thread last looked at it
+    [[nodiscard]] auto snapshot(VoicePool::Index voice) const noexcept -> State;
+
+    // note : how many times the game thread waited for room in the queue
+    [[nodiscard]] auto waits() const noexcept -> std::uint64_t { return m_waits; }
+
+private:
+    struct Voice {
+        ALuint source{0}; // note : or the index of the voice in the mixer
+        entt::resource_handle<AudioFileBuffer> buffer{};
+        std::uint32_t sequence{0};
+    };
+
+    auto run() -> void;
+
+    auto drain() -> void;
+
+    auto execute(Command &command) -> void;
+
+    // note : refresh the snapshot and feed the music streams
+    auto tick() -> void;
+
+    [[nodiscard]] auto status(const Voice &voice) const -> SoundStatus;
+
+    std::unique_ptr<SoftwareMixer> m_mixer;
+    bool m_threaded;
+
+    std::vector<Voice> m_voices;
+    std::vector<MusicStream *> m_streams;
+
+    SpscQueue<Command, QUEUE> m_queue;
+
+    // note : the status in the low byte, the sequence above
+    std::unique_ptr<std::atomic<std::uint64_t>[]> m_snapshot;
+
+    std::uint64_t m_waits{0};
+
+    std::atomic<bool> m_stop{false};
+    std::thread m_thread;
+};
+
+} // namespace engine
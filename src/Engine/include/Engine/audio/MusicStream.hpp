@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AL/al.h>
+
+#include "Engine/audio/SoftwareMixer.hpp"
+
+namespace engine {
+
+// note : a long sound played from a few queued buffers, its memory does not depend on its length
+//        a thread opens the file and copies the next chunks of samples ahead of the playback
+//        the OpenAL calls are only done by the @AudioThread, see @MusicStream::update
+//        without OpenAL device, the chunks are converted and queued on a stream of the @SoftwareMixer instead
+//        the game thread only changes what the next update applies
+class MusicStream {
+public:
+    static constexpr std::size_t BUFFERS = 4;
+    static constexpr std::size_t CHUNK_BYTES = 64 * 1024;
+
+    // note : silent, nothing is ever played
+    MusicStream() = default;
+
+    // note : the path is relative to the data folder
+    explicit MusicStream(const std::string &path);
+    ~MusicStream();
+
+    MusicStream(const MusicStream &) = delete;
+    MusicStream &operator=(const MusicStream &) = delete;
+
+    // note : any thread, the playback starts once the first chunk is ready
+    //        a stopped music, or one that is over, is played again from the beginning
+    auto play() -> MusicStream &;
+    auto stop() -> MusicStream &;
+
+    // Range [0, +inf]
+    auto setVolume(float volume) -> MusicStream &;
+    auto setLoop(bool loop) -> MusicStream &;
+
+    [[nodiscard]] auto isPlaying() const noexcept -> bool { return m_playing; }
+
+    // note : audio thread, queue the chunks copied since the last update in place of the buffers played
+    //        the OpenAL objects are created by the first update, unless the stream is mixed in software
+    auto update(bool software) -> void;
+
+    // note : audio thread, attached to the @SoftwareMixer while the stream is played by the @AudioThread
+    [[nodiscard]] auto mixed() noexcept -> SoftwareMixer::Stream & { return m_mixed; }
+
+    // note : audio thread, or once it is gone, release the thread and the OpenAL objects
+    //        the stream stays silent afterward
+    auto close() -> void;
+
+private:
+    auto produce(const std::string &path) -> void;
+
+    // note : audio thread, @MusicStream::update for the @SoftwareMixer
+    auto feed() -> void;
+
+    // note : audio thread, drop the queued buffers and ask the thread to copy from the beginning of the file
+    auto rewind() -> void;
+
+    ALuint m_source{0};
+    std::array<ALuint, BUFFERS> m_buffers{};
+    std::vector<ALuint> m_idle; // note : not queued on the source
+    float m_gain{1.0f};          // note : applied to the source
+    bool m_started{false};       // note : played since the last rewind
+
+    SoftwareMixer::Stream m_mixed; // note : in place of the source and the buffers
+
+    std::atomic<bool> m_playing{false};
+    std::atomic<float> m_volume{1.0f};
+
+    // note : written by the thread before it publishes the first chunk
+    ALenum m_format{0};
+    ALsizei m_sample_rate{0};
+
+    std::array<std::vector<char>, BUFFERS> m_chunks;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::size_t m_read{0};  // note : the next chunk queued by the audio thread
+    std::size_t m_write{0}; // note : the next chunk copied by the thread
+    bool m_finished{false}; // note : every chunk of a stream not looping has been copied
+    bool m_rewind{false};   // note : the next chunk copied by the thread is the first of the file
+    bool m_stop{false};
+
+    std::atomic<bool> m_loop{false};
+
+    std::thread m_thread;
+};
+
+} // namespace engine
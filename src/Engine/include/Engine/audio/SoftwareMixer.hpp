@@ -0,0 +1,115 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Engine/audio/VoicePool.hpp"
+
+namespace engine {
+
+// note : mix the voices on the CPU, for the machines without a sound device or to measure the cost of the audio
+//        the output is 48 kHz stereo, written to a wav file or dropped by the null sink
+//        only touched by the @AudioThread, the time is given by @SoftwareMixer::advance
+class SoftwareMixer {
+public:
+    static constexpr std::int32_t SAMPLE_RATE = 48000;
+
+    // note : frames mixed at once
+    static constexpr std::size_t BLOCK = 1024;
+
+    // note : the samples of a sound in [-1; 1], interleaved
+    struct Clip {
+        std::vector<float> samples;
+        std::uint8_t channels;
+        std::int32_t sample_rate;
+
+        [[nodiscard]] auto frames() const noexcept -> std::size_t { return samples.size() / channels; }
+    };
+
+    // note : a voice fed with clips one after the other, like an OpenAL source with queued buffers
+    //        owned by its user, who queues the next clips and takes back the played ones to reuse their memory
+    struct Stream {
+        std::deque<Clip> queued;
+        std::vector<Clip> played;
+        double position{0.0}; // note : in frames of the first clip queued
+        float gain{1.0f};
+        bool playing{false}; // note : cleared by the mixer when it runs out of clips
+    };
+
+    struct Stats {
+        std::uint64_t frames{0};         // mixed, at SAMPLE_RATE
+        std::uint64_t voice_frames{0};   // rendered by the voices
+        std::chrono::nanoseconds time{0}; // spent mixing
+    };
+
+    // note : an empty path for the null sink
+    SoftwareMixer(std::size_t voices, const std::string &wav);
+    ~SoftwareMixer();
+
+    SoftwareMixer(const SoftwareMixer &) = delete;
+    SoftwareMixer &operator=(const SoftwareMixer &) = delete;
+
+    // note : the clip must outlive its use by the voice, the parameters of the voice are reset
+    auto assign(std::size_t voice, const Clip *clip) -> void;
+
+    auto play(std::size_t voice) -> void;
+    auto stop(std::size_t voice) -> void;
+
+    auto setPitch(std::size_t voice, float pitch) -> void { m_voices[voice].pitch = pitch; }
+    auto setGain(std::size_t voice, float gain) -> void { m_voices[voice].gain = gain; }
+    auto setLoop(std::size_t voice, bool loop) -> void { m_voices[voice].loop = loop; }
+
+    [[nodiscard]] auto status(std::size_t voice) const -> SoundStatus { return m_voices[voice].status; }
+    [[nodiscard]] auto pitch(std::size_t voice) const -> float { return m_voices[voice].pitch; }
+    [[nodiscard]] auto gain(std::size_t voice) const -> float { return m_voices[voice].gain; }
+    [[nodiscard]] auto loop(std::size_t voice) const -> bool { return m_voices[voice].loop; }
+
+    // note : the stream must be detached before being destroyed
+    auto attach(Stream *stream) -> void;
+    auto detach(Stream *stream) -> void;
+
+    // note : mix the frames covering the time elapsed, the remainder is kept for the next call
+    auto advance(std::chrono::nanoseconds elapsed) -> void;
+
+    auto mix(std::size_t frames) -> void;
+
+    [[nodiscard]] auto stats() const noexcept -> const Stats & { return m_stats; }
+
+private:
+    struct Voice {
+        const Clip *clip{nullptr};
+        double position{0.0}; // note : in frames of the clip
+        float pitch{1.0f};
+        float gain{1.0f};
+        bool loop{false};
+        SoundStatus status{SoundStatus::INITIAL};
+    };
+
+    // note : resample the voice to SAMPLE_RATE in stereo, return the frames rendered before the end of the clip
+    static auto render(Voice &voice, float *out, std::size_t frames) -> std::size_t;
+
+    // note : render the clips queued one after the other, return the frames rendered before running out of clips
+    static auto render(Stream &stream, float *out, std::size_t frames) -> std::size_t;
+
+    auto write(const std::int16_t *samples, std::size_t count) -> void;
+
+    std::vector<Voice> m_voices;
+    std::vector<Stream *> m_streams;
+
+    std::vector<float> m_bus;
+    std::vector<float> m_scratch;
+    std::vector<std::int16_t> m_output;
+
+    std::chrono::nanoseconds m_pending{0};
+
+    std::ofstream m_wav;
+    std::uint64_t m_written{0}; // note : bytes of samples in the wav file
+
+    Stats m_stats;
+};
+
+} // namespace engine
@@ -1,23 +1,17 @@
 #pragma once
 
-#include <memory>
-#include <AL/al.h>
+#include "Engine/audio/VoicePool.hpp"
 
 namespace engine {
 
-enum class SoundStatus {
-    INITIAL,
-    PLAYING,
-    PAUSED,
-    STOPPED,
-};
-
+// note : a handle to a voice of the @VoicePool, cheap to copy
+//        once the voice is released or stolen, every call does nothing
 class Sound {
 public:
-    explicit Sound(ALuint soundBuffer);
-    ~Sound();
+    // note : silent, nothing is ever played
+    Sound() = default;
 
-    static std::shared_ptr<Sound> GetEmptySound();
+    Sound(VoicePool &pool, VoicePool::Handle handle);
 
     auto play() -> Sound &;
     auto stop() -> Sound &;
@@ -33,15 +27,9 @@ public:
     auto getVolume() const -> float;
     auto doesLoop() const -> bool;
 
-    // Don't call that yourself
-    auto forceDestroy() -> void;
-
-private:
-    Sound(); // Not alive;
-
 private:
-    ALuint m_buffer;
-    bool m_alive = true;
+    VoicePool *m_pool{nullptr};
+    VoicePool::Handle m_handle;
 };
 
 } // namespace engine
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "Engine/audio/Sound.hpp"
+#include "Engine/resources/ResourceId.hpp"
+
+namespace engine {
+
+class AudioManager;
+
+// note : the requests to play a sound are collected during the frame and played once per frame
+//        the same sound requested several times in a frame takes a single voice, louder
+//        a sound is limited by the cooldown and the instances of its rule, the requests over the limits are dropped
+class SoundEvents {
+public:
+    struct Rule {
+        std::chrono::milliseconds cooldown{0}; // note : since the last time the sound started
+        std::uint32_t instances{0};            // note : playing at once, 0 for no limit
+        float max_gain{2.0f};                  // note : of the requests merged in one voice
+    };
+
+    struct Stats {
+        std::uint64_t requested{0};
+        std::uint64_t played{0};
+        std::uint64_t merged{0};    // note : requests played by the voice of another one
+        std::uint64_t throttled{0}; // note : requests dropped by a cooldown or a limit of instances
+    };
+
+    // note : the json object maps the path of a sound to its rule, "default" is the rule of the other sounds
+    //        { "sounds/fire_hit.wav": { "cooldown": 40, "instances": 4, "max_gain": 1.5 } }
+    auto fromFile(const std::string_view path) -> bool;
+
+    auto setRule(const ResourceId &sound, const Rule &rule) -> void;
+
+    auto setDefaultRule(const Rule &rule) -> void { m_default = rule; }
+
+    // note : nothing is played until @SoundEvents::flush
+    auto post(const ResourceId &sound, SoundPriority priority = SoundPriority::NORMAL, float volume = 1.0f) -> void;
+
+    // note : once per frame, play the requests of the frame
+    auto flush(AudioManager &audio, std::chrono::nanoseconds elapsed) -> void;
+
+    [[nodiscard]] auto stats() const noexcept -> const Stats & { return m_stats; }
+
+private:
+    struct Entry {
+        ResourceId sound;
+
+        // note : the requests of the frame
+        std::uint32_t requests{0};
+        SoundPriority priority{SoundPriority::LOW};
+        float volume{0.0f};
+
+        std::optional<std::chrono::nanoseconds> started;
+        std::vector<Sound> playing;
+    };
+
+    [[nodiscard]] auto rule(entt::id_type id) const -> const Rule &;
+
+    Rule m_default;
+    std::unordered_map<entt::id_type, Rule> m_rules;
+
+    std::unordered_map<entt::id_type, Entry> m_entries;
+    std::vector<entt::id_type> m_pending; // note : the sounds requested during the frame
+
+    std::chrono::nanoseconds m_time{0};
+    Stats m_stats;
+};
+
+} // namespace engine
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+namespace engine {
+
+class AudioFileBuffer;
+class AudioThread;
+
+enum class SoundStatus {
+    INITIAL,
+    PLAYING,
+    PAUSED,
+    STOPPED,
+};
+
+// note : which voice is stolen when every voice is busy
+enum class SoundPriority {
+    LOW,    // frequent and short, the hits for instance
+    NORMAL, // the user interface
+    HIGH,   // rare events the player must hear
+    MUSIC,  // never stolen by a sound effect
+};
+
+// note : the voices are created once by the @AudioThread, a sound takes a voice and gives it back once played
+//        over the limit, the oldest voice of the lowest priority is stolen, a handle to it becomes silent
+//        acquiring and releasing a voice do not depend on the number of voices
+//        only the game thread uses the pool, every change is posted to the audio thread and never waited for
+class VoicePool {
+public:
+    static constexpr std::size_t CAPACITY = 32;
+
+    using Index = std::uint16_t;
+
+    static constexpr Index npos = std::numeric_limits<Index>::max();
+
+    struct Handle {
+        Index index{npos};
+        std::uint32_t generation{0};
+    };
+
+    explicit VoicePool(AudioThread &audio);
+
+    VoicePool(const VoicePool &) = delete;
+    VoicePool &operator=(const VoicePool &) = delete;
+
+    // note : nullopt if every voice is busy with a higher priority
+    auto acquire(entt::resource_handle<AudioFileBuffer> buffer, SoundPriority priority) -> std::optional<Handle>;
+
+    // note : nothing is done if the voice has been released or stolen since
+    auto play(const Handle &handle) -> void;
+    auto stop(const Handle &handle) -> void;
+    auto setPitch(const Handle &handle, float pitch) -> void;
+    auto setGain(const Handle &handle, float gain) -> void;
+    auto setLoop(const Handle &handle, bool loop) -> void;
+
+    // note : a voice released or stolen is STOPPED and silent
+    //        until the audio thread has applied the last command, the status is the one expected from it
+    [[nodiscard]] auto status(const Handle &handle) const -> SoundStatus;
+    [[nodiscard]] auto pitch(const Handle &handle) const -> float;
+    [[nodiscard]] auto gain(const Handle &handle) const -> float;
+    [[nodiscard]] auto loop(const Handle &handle) const -> bool;
+
+    // note : once per frame, release the voices done playing
+    auto update() -> void;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_voices.size(); }
+
+    [[nodiscard]] auto busy() const noexcept -> std::size_t { return m_voices.size() - m_free.size(); }
+
+    [[nodiscard]] auto stolen() const noexcept -> std::uint64_t { return m_stolen; }
+
+private:
+    static constexpr auto PRIORITIES = static_cast<std::size_t>(SoundPriority::MUSIC) + 1;
+
+    struct Voice {
+        std::uint32_t generation{0};
+        SoundPriority priority{SoundPriority::LOW};
+        bool busy{false};
+        std::uint64_t frame{0}; // note : when the voice has been acquired
+
+        // note : what has been posted to the audio thread, the last command is numbered by sequence
+        std::uint32_t sequence{0};
+        SoundStatus expected{SoundStatus::INITIAL};
+        float pitch{1.0f};
+        float gain{1.0f};
+        bool loop{false};
+
+        // note : the busy voices of the same priority, the oldest first
+        Index prev{npos};
+        Index next{npos};
+    };
+
+    struct List {
+        Index head{npos};
+        Index tail{npos};
+    };
+
+    // note : nullptr if the voice has been released or stolen since
+    [[nodiscard]] auto find(const Handle &handle) noexcept -> Voice *;
+    [[nodiscard]] auto find(const Handle &handle) const noexcept -> const Voice *;
+
+    [[nodiscard]] auto status(Index index) const -> SoundStatus;
+
+    auto link(Index index) -> void;
+    auto unlink(Index index) -> void;
+    auto release(Index index) -> void;
+
+    AudioThread &m_audio;
+
+    std::vector<Voice> m_voices;
+    std::vector<Index> m_free;
+    std::array<List, PRIORITIES> m_busy;
+
+    std::uint64_t m_frame{0};
+    std::uint64_t m_stolen{0};
+};
+
+} // namespace engine
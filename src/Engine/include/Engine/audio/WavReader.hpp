@@ -1,13 +1,22 @@
 #pragma once
 
-#include <string>
-#include <AL/al.h>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 
 namespace engine {
 
-// copy-pasta from https://indiegamedev.net/2020/02/15/the-complete-guide-to-openal-with-c-part-1-playing-a-sound/
-auto load_wav(
-    const std::string_view filename, std::uint8_t &channels, std::int32_t &sampleRate, std::uint8_t &bitsPerSample, ALsizei &size)
-    -> char *;
+// note : the description of a wav file and a view on its samples, nothing is copied
+struct Wav {
+    std::uint8_t channels;
+    std::int32_t sample_rate;
+    std::uint8_t bits_per_sample;
+
+    std::string_view samples; // note : whole frames only
+};
+
+// note : walk the chunks of a RIFF WAVE file already in memory, the chunks other than "fmt " and "data" are skipped
+//        only the integer PCM samples are supported, nullopt if the file is malformed or of another encoding
+auto load_wav(const std::string_view content) -> std::optional<Wav>;
 
 } // namespace engine
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include "Engine/component/Spritesheet.hpp"
+
+namespace engine {
+
+// note : the per-entity part of a spritesheet, cheap to create and to copy
+//        see @DrawableFactory::fix_spritesheet to change the animation
+struct AnimationState {
+    // note : owned by the AssetLoader, nullptr until a spritesheet is given
+    const Spritesheet *sheet{nullptr};
+
+    std::uint16_t animation{Spritesheet::npos};
+    std::uint16_t frame{0};
+
+    // note : time left before the next frame
+    std::chrono::milliseconds remaining{0};
+
+    bool attack_animation_finish{true};
+
+    [[nodiscard]] auto isPlaying() const noexcept -> bool { return sheet != nullptr && animation != Spritesheet::npos; }
+
+    [[nodiscard]] auto current() const noexcept -> const Spritesheet::Animation & { return sheet->animations[animation]; }
+
+    [[nodiscard]] auto is(const std::string_view name) const noexcept -> bool
+    {
+        return isPlaying() && current().name == name;
+    }
+};
+
+} // namespace engine
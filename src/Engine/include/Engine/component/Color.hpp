@@ -1,29 +1,20 @@
 #pragma once
 
-#include <array>
-#include <cstdint>
-
 #include <glm/vec4.hpp>
 
 namespace engine {
 
+// note : a plain value, sent to the shader as an uniform at draw time // see @DrawableFactory::fix_color
 struct Color {
-    std::array<float, 16ul> vertices{};
-    std::uint32_t VBO{0u};
-
-    static constexpr auto r(const Color &c) noexcept -> float { return c.vertices[0]; }
-
-    static constexpr auto g(const Color &c) noexcept -> float { return c.vertices[1]; }
+    glm::vec4 value{1.0f, 1.0f, 1.0f, 1.0f};
 
-    static constexpr auto b(const Color &c) noexcept -> float { return c.vertices[2]; }
+    static constexpr auto r(const Color &c) noexcept -> float { return c.value.r; }
 
-    static constexpr auto a(const Color &c) noexcept -> float { return c.vertices[3]; }
+    static constexpr auto g(const Color &c) noexcept -> float { return c.value.g; }
 
-    // note : you should not call this function yourself // see @DrawableFactory::fix_color
-    static auto ctor(glm::vec4 &&color) -> Color;
+    static constexpr auto b(const Color &c) noexcept -> float { return c.value.b; }
 
-    // note : you should not call this function yourself // see @DrawableFactory::fix_color
-    static auto dtor(Color *color) -> void;
+    static constexpr auto a(const Color &c) noexcept -> float { return c.value.a; }
 };
 
 } // namespace engine
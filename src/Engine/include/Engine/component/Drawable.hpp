@@ -4,18 +4,9 @@
 
 namespace engine {
 
-class Shader;
-
-// todo : redo me // see @Color component
+// note : every drawable shares the unit quad owned by the renderer // see @Renderer
 struct Drawable {
-    std::uint32_t VBO{0};
-    std::uint32_t VAO{0};
-    std::uint32_t EBO{0};
-
-    int triangle_count;
-
-    static auto dtor(const Drawable &drawable) -> void;
-
+    int triangle_count{2};
 };
 
 } // namespace engine
@@ -2,6 +2,10 @@
 
 #include <cstdint>
 #include <array>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 #include <fstream>
 
@@ -12,30 +16,46 @@
 
 #include "Engine/component/Position.hpp"
 #include "Engine/component/Cooldown.hpp"
+#include "Engine/resources/ResourceId.hpp"
 
 namespace engine {
 
+// note : the definition of the animations, parsed once and shared by every entity using it (see @AssetLoader)
+//        the per-entity part is in @AnimationState
 struct Spritesheet {
+    static constexpr std::uint16_t npos = 0xffff;
+
     struct Animation {
+        std::string name;
         std::string file;
+        ResourceId texture; // note : interned from `file` when loaded
         std::uint16_t width;
         std::uint16_t height;
 
         std::vector<d2::PositionT<std::uint16_t>> frames;
 
+        // note : clip rectangle of each frame, computed when the spritesheet is loaded
+        std::vector<std::array<float, 4ul>> uvs;
+
         std::chrono::milliseconds cooldown;
     };
 
-    std::unordered_map<std::string, Animation> animations;
-
-    Cooldown cooldown;
+    // note : looked up by index, a spritesheet has only a handful of animations
+    std::vector<Animation> animations;
 
-    std::uint16_t current_frame{0};
-    std::string current_animation{"default"};
-
-    bool attack_animation_finish{true};
+    // note : index of the animation, npos if there is none with this name
+    [[nodiscard]] auto find(const std::string_view name) const noexcept -> std::uint16_t
+    {
+        for (auto i = 0ul; i != animations.size(); i++) {
+            if (animations[i].name == name) return static_cast<std::uint16_t>(i);
+        }
+        return npos;
+    }
 
     static auto from_json(const std::string_view file) -> Spritesheet;
+
+    // note : width and height of an image, only its header is read, nullopt if it can't be read
+    static auto imageSize(const std::string_view file) -> std::optional<std::array<std::int32_t, 2>>;
 };
 
 // todo : move in .cpp
@@ -56,6 +76,7 @@ inline void to_json(nlohmann::json &j, const engine::Spritesheet::Animation &ani
 inline void from_json(const nlohmann::json &j, engine::Spritesheet::Animation &animation)
 {
     animation.file = j.at("file");
+    animation.texture = ResourceId::intern(animation.file);
     animation.width = j.at("width");
     animation.height = j.at("height");
     animation.cooldown = std::chrono::milliseconds{j.at("cooldown")};
@@ -64,24 +85,19 @@ inline void from_json(const nlohmann::json &j, engine::Spritesheet::Animation &a
 
 inline void to_json(nlohmann::json &j, const engine::Spritesheet &sprite)
 {
-    j = nlohmann::json{{"object", {"animations", sprite.animations}}};
+    auto animations = nlohmann::json::object();
+    for (const auto &animation : sprite.animations) animations[animation.name] = animation;
+    j = nlohmann::json{{"object", {{"animations", animations}}}};
 }
 
 inline void from_json(const nlohmann::json &j, engine::Spritesheet &sprite)
 {
-    using namespace std::chrono_literals;
-
-    sprite.animations = j.at("object").at("animations").get<std::decay_t<decltype(sprite.animations)>>();
-    sprite.cooldown.is_in_cooldown = false;
-    sprite.cooldown.cooldown = 0ms;
-    sprite.cooldown.remaining_cooldown = 0ms;
-}
-
-inline auto Spritesheet::from_json(const std::string_view file) -> Spritesheet
-{
-    std::ifstream f(file.data());
-    const auto json = nlohmann::json::parse(f);
-    return json.get<Spritesheet>();
+    // note : the items of a json object are iterated by name
+    sprite.animations.clear();
+    for (const auto &[name, data] : j.at("object").at("animations").items()) {
+        auto &animation = sprite.animations.emplace_back(data.get<engine::Spritesheet::Animation>());
+        animation.name = name;
+    }
 }
 
 } // namespace engine
@@ -10,6 +10,7 @@
 #include <entt/entt.hpp>
 
 #include <Engine/Graphics/third_party.hpp>
+#include <Engine/resources/ResourceId.hpp>
 #include <stb_image.h>
 
 namespace engine {
@@ -17,18 +18,30 @@ namespace engine {
 struct Drawable;
 struct Color;
 struct VBOTexture;
+struct Texture;
+struct Spritesheet;
 
 struct DrawableFactory {
     static auto rectangle() -> Drawable;
 
+    // note : load the texture in the cache if needed
+    static auto texture(const ResourceId &, bool mirrored_repeated = false)
+        -> entt::resource_handle<Texture>;
+
     static auto fix_color(entt::registry &, entt::entity, glm::vec4 &&color) -> Color &;
     static auto fix_texture(
         entt::registry &,
         entt::entity,
-        const std::string_view filepath,
+        const ResourceId &,
         bool mirrored_repeated = false,
         const std::array<float, 4ul> &clip = {0.0f, 0.0f, 1.0f, 1.0f}) -> VBOTexture &;
 
+    // note : give the spritesheet to the entity and start the animation
+    static auto fix_spritesheet(
+        entt::registry &world, entt::entity entity, const Spritesheet &spritesheet, const std::string_view animation)
+        -> void;
+
+    // note : change the animation of the current spritesheet
     static auto fix_spritesheet(entt::registry &world, entt::entity entity, const std::string_view animation) -> void;
 };
 
@@ -1,18 +1,20 @@
 #pragma once
 
-#include <fstream>
 #include <optional>
 #include <string>
 #include <string_view>
 
+#include "Engine/resources/FileSystem.hpp"
+#include "Engine/Core.hpp"
+
 namespace engine {
 
-// short but fancy way
-auto getFileContent(const std::string_view file) -> std::optional<std::string>
+// note : the file is read through the FileSystem, so it can come from the asset pack
+inline auto getFileContent(const std::string_view file) -> std::optional<std::string>
 {
-    std::ifstream t(file.data());
-    if (!t) return {};
-    return std::string(std::istreambuf_iterator<char>(t), std::istreambuf_iterator<char>());
+    const auto content = Core::Holder{}.instance->getFileSystem().read(file);
+    if (!content.has_value()) return {};
+    return std::string{content->view()};
 }
 
 } // namespace engine
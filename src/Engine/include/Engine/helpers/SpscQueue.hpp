@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+namespace engine {
+
+// note : a fixed ring of N values between one producer thread and one consumer thread, without lock
+//        each side keeps a copy of the other index and only reads the shared one when the copy says full or empty
+template<typename T, std::size_t N>
+class SpscQueue {
+    static_assert(N != 0 && (N & (N - 1)) == 0, "the capacity must be a power of two");
+
+public:
+    static constexpr std::size_t CAPACITY = N;
+
+    // note : producer only, false if the queue is full
+    auto push(T &&value) -> bool
+    {
+        const auto write = m_write.load(std::memory_order_relaxed);
+        if (write - m_read_cache == N) {
+            m_read_cache = m_read.load(std::memory_order_acquire);
+            if (write - m_read_cache == N) return false;
+        }
+
+        m_slots[write & (N - 1)] = std::move(value);
+        m_write.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // note : consumer only, nullopt if the queue is empty
+    auto pop() -> std::optional<T>
+    {
+        const auto read = m_read.load(std::memory_order_relaxed);
+        if (read == m_write_cache) {
+            m_write_cache = m_write.load(std::memory_order_acquire);
+            if (read == m_write_cache) return {};
+        }
+
+        // note : the slot is left moved from, it does not keep the resources of the value
+        std::optional<T> out{std::move(m_slots[read & (N - 1)])};
+        m_read.store(read + 1, std::memory_order_release);
+        return out;
+    }
+
+private:
+    // note : the two sides are on their own cache lines
+    alignas(64) std::atomic<std::size_t> m_write{0};
+    std::size_t m_read_cache{0};
+
+    alignas(64) std::atomic<std::size_t> m_read{0};
+    std::size_t m_write_cache{0};
+
+    alignas(64) std::array<T, N> m_slots{};
+};
+
+} // namespace engine
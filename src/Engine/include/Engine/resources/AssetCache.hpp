@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Engine/resources/Pixels.hpp"
+#include "Engine/component/Spritesheet.hpp"
+
+namespace engine {
+
+// note : the result of the slow loaders kept in the output folder, named after the hash of the source content
+//        a texture is stored decoded in RGBA8 with its mipmaps, and mapped straight into the upload on a warm start
+//        a spritesheet is stored with the clip rectangles already computed, and the size of the images they come from
+//        a shader program is stored as given by the driver, see @Shader
+//        a modified source gets a new name, the stale entries are never read again and can be deleted at any time
+//        every method can be called by any thread, an entry is written in a temporary file then renamed
+class AssetCache {
+public:
+    static constexpr std::uint32_t kVersion = 2;
+
+    struct Config {
+        std::string folder;   // where the entries are written
+        bool enabled{true};   // false to always decode the sources
+        bool mipmaps{true};   // store the mipmaps of the textures, otherwise they are generated by OpenGL
+    };
+
+    // note : a linked program given by glGetProgramBinary, only valid for the driver which produced it
+    struct ProgramBinary {
+        std::uint32_t format;
+        std::string data;
+    };
+
+    explicit AssetCache(Config &&config);
+
+    // note : nullopt if the image can not be read or decoded
+    auto texture(const std::string_view path) const -> std::optional<Pixels>;
+
+    // note : throw like Spritesheet::from_json
+    auto spritesheet(const std::string_view path) const -> Spritesheet;
+
+    // note : the key must cover the sources of the program and the driver, nullopt if it has never been stored
+    auto program(std::uint64_t key) const -> std::optional<ProgramBinary>;
+
+    auto storeProgram(std::uint64_t key, const ProgramBinary &binary) const -> void;
+
+    // note : 64 bits FNV-1a
+    static auto hash(const std::string_view content) noexcept -> std::uint64_t;
+
+private:
+    auto entry(std::uint64_t key, const std::string_view extension) const -> std::string;
+
+    static auto write(const std::string &path, const std::vector<std::string_view> &parts) -> void;
+
+    Config m_config;
+};
+
+} // namespace engine
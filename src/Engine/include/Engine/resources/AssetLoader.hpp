@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <deque>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <entt/entt.hpp>
+
+#include "Engine/resources/ResourceId.hpp"
+#include "Engine/resources/Texture.hpp"
+#include "Engine/resources/TextureResidency.hpp"
+#include "Engine/resources/Pixels.hpp"
+#include "Engine/audio/AudioFileBuffer.hpp"
+#include "Engine/component/Spritesheet.hpp"
+
+namespace engine {
+
+// note : the files are read and decoded by a pool of workers, the main thread only uploads
+//        the result to OpenGL / OpenAL, within a time budget per frame (see AssetLoader::update)
+class AssetLoader {
+public:
+    // note : the paths are relative to the data folder
+    struct Manifest {
+        std::vector<std::string> textures;
+        std::vector<std::string> sounds;
+        std::vector<std::string> spritesheets;
+    };
+
+    AssetLoader(const std::string &data_folder, std::size_t threads);
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader &) = delete;
+    AssetLoader &operator=(const AssetLoader &) = delete;
+
+    // note : return a placeholder texture at once, its pixels are uploaded later under the same name
+    auto texture(const ResourceId &, bool mirrored_repeated = false) -> entt::resource_handle<Texture>;
+
+    // note : the OpenGL name of a texture about to be drawn, given by the id of @VBOTexture
+    //        a texture released over the budget is loaded again, 0 if it has never been requested
+    auto use(entt::id_type id) -> std::uint32_t;
+
+    // note : decode the sound in the background, see @AudioManager::getSound
+    auto sound(const ResourceId &) -> void;
+
+    // note : wait for the sound if it is being decoded, nullopt if it has never been requested
+    auto takeSound(const ResourceId &) -> std::optional<AudioFileBuffer::Pcm>;
+
+    // note : parsed once and shared, the reference stays valid as long as the loader
+    auto spritesheet(const ResourceId &) -> const Spritesheet &;
+
+    auto preload(const Manifest &) -> void;
+
+    // note : must be called once per frame by the thread owning the OpenGL context
+    auto update(std::chrono::microseconds budget) -> void;
+
+    [[nodiscard]] auto pending() const noexcept -> std::size_t { return m_requested.size(); }
+
+private:
+    struct DecodedTexture {
+        entt::id_type id;
+        std::optional<Pixels> pixels;
+        std::chrono::nanoseconds elapsed; // note : spent by the worker, see @CacheStats::load_time
+    };
+
+    struct DecodedSound {
+        entt::id_type id;
+        std::optional<AudioFileBuffer::Pcm> pcm;
+    };
+
+    struct ParsedSpritesheet {
+        entt::id_type id;
+        std::optional<Spritesheet> spritesheet;
+    };
+
+    using Decoded = std::variant<DecodedTexture, DecodedSound, ParsedSpritesheet>;
+
+    struct Job {
+        enum Kind {
+            TEXTURE,
+            SOUND,
+            SPRITESHEET,
+
+            KIND_MAX
+        };
+
+        Kind kind;
+        entt::id_type id;
+        std::string path;
+    };
+
+    auto push(Job &&) -> void;
+
+    auto decode(const Job &) -> Decoded;
+
+    auto apply(Decoded &&) -> void;
+
+    // note : a texture released over the budget, uploaded before returning so it is never drawn transparent
+    auto reload(entt::id_type id, const TextureResidency::Entry &) -> entt::resource_handle<Texture>;
+
+    std::string m_data_folder;
+
+    // note : only touched by the main thread
+    std::unordered_set<entt::id_type> m_requested;
+    TextureResidency m_residency;
+    // note : the nodes never move, see @AnimationState::sheet
+    std::unordered_map<entt::id_type, Spritesheet> m_spritesheets;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Job> m_jobs;
+    std::deque<Decoded> m_decoded;
+    bool m_stop{false};
+    std::vector<std::thread> m_workers;
+};
+
+} // namespace engine
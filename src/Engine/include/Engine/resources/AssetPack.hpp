@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Engine/resources/MappedFile.hpp"
+
+namespace engine {
+
+// note : every file of the data folder in one archive, mapped once and read in place
+//
+//        | Header | file | padding | file | ... | Entry[count] | paths |
+//
+//        the entries are sorted by the hash of their path, the same hash as @ResourceId,
+//        the content of the files is aligned on kAlignment bytes and stored uncompressed
+//        the integers are written in the native byte order, the pack is not meant to be shared across platforms
+class AssetPack {
+public:
+    static constexpr char kMagic[4] = {'P', 'A', 'C', 'K'};
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::uint64_t kAlignment = 64;
+
+    struct Header {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t count;
+        std::uint32_t reserved;
+        std::uint64_t entries_offset;
+        std::uint64_t paths_offset;
+    };
+
+    struct Entry {
+        std::uint32_t hash;
+        std::uint32_t path_offset; // note : relative to Header::paths_offset
+        std::uint32_t path_size;
+        std::uint32_t reserved;
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+
+    // note : nullopt if the file is missing or is not a valid pack
+    static auto open(const std::string_view path) -> std::optional<AssetPack>;
+
+    // note : write every regular file under the folder, the paths are stored relative to it with '/' as separator
+    static auto build(const std::string &folder, const std::string &output) -> bool;
+
+    // note : the view stays valid as long as the pack
+    [[nodiscard]] auto find(const std::string_view path) const -> std::optional<std::string_view>;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_header->count; }
+
+private:
+    explicit AssetPack(MappedFile &&file);
+
+    MappedFile m_file;
+
+    const Header *m_header;
+    const Entry *m_entries;
+    const char *m_paths;
+};
+
+} // namespace engine
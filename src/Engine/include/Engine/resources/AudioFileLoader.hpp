@@ -1,10 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 
 #include <entt/entt.hpp>
 
 #include "Engine/audio/AudioFileBuffer.hpp"
+#include "Engine/resources/ResourceCache.hpp"
 
 namespace engine {
 
@@ -12,10 +14,10 @@ struct AudioFileLoader : entt::resource_loader<AudioFileLoader, AudioFileBuffer>
     template<typename... Args>
     auto load(Args &&... args) const -> std::shared_ptr<AudioFileBuffer>
     {
-        return std::make_shared<AudioFileBuffer>(std::move(args)...);
+        return std::make_shared<AudioFileBuffer>(std::forward<Args>(args)...);
     }
 };
 
-using AudioFileCache = entt::resource_cache<AudioFileBuffer>;
+using AudioFileCache = ResourceCache<AudioFileBuffer>;
 
 } // namespace engine
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Engine/resources/AssetPack.hpp"
+#include "Engine/resources/MappedFile.hpp"
+
+namespace engine {
+
+// note : every loader reads the data folder through this, the files are looked up in the asset pack first
+//        then mapped from the disk, so a file missing from the pack can still be edited during the development
+//        the pack is immutable once mounted, a read can be done by any thread
+class FileSystem {
+public:
+    // note : a view on the content of a file, valid as long as the File and the FileSystem
+    class File {
+    public:
+        [[nodiscard]] auto data() const noexcept -> const char * { return m_view.data(); }
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t { return m_view.size(); }
+
+        [[nodiscard]] auto view() const noexcept -> std::string_view { return m_view; }
+
+    private:
+        friend FileSystem;
+
+        // note : only for a file mapped from the disk
+        std::optional<MappedFile> m_mapping;
+        std::string_view m_view;
+    };
+
+    explicit FileSystem(const std::string &data_folder);
+
+    auto mount(const std::string_view pack) -> bool;
+
+    [[nodiscard]] auto isMounted() const noexcept -> bool { return m_pack.has_value(); }
+
+    // note : the path is relative to the data folder or starts with it
+    [[nodiscard]] auto read(const std::string_view path) const -> std::optional<File>;
+
+private:
+    std::string m_data_folder;
+
+    std::optional<AssetPack> m_pack;
+};
+
+} // namespace engine
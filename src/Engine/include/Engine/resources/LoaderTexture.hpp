@@ -6,6 +6,7 @@
 
 #include <spdlog/spdlog.h>
 
+#include "Engine/resources/ResourceCache.hpp"
 #include "Engine/resources/Texture.hpp"
 
 namespace engine {
@@ -20,6 +21,14 @@ struct LoaderTexture : entt::resource_loader<LoaderTexture, Texture> {
     }
 };
 
-using CacheTexture = entt::resource_cache<Texture>;
+// note : the pixels are decoded in the background // see @AssetLoader
+struct LoaderTexturePlaceholder : entt::resource_loader<LoaderTexturePlaceholder, Texture> {
+    auto load(bool mirrored_repeated) const -> std::shared_ptr<Texture>
+    {
+        return std::shared_ptr<Texture>(new Texture{Texture::placeholder(mirrored_repeated)}, Texture::dtor);
+    }
+};
+
+using CacheTexture = ResourceCache<Texture, LeastRecentlyUsed>;
 
 } // namespace engine
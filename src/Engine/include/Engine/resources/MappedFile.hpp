@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace engine {
+
+// note : a read-only view of a whole file mapped in memory, the pages are loaded by the system on access
+class MappedFile {
+public:
+    static auto open(const std::string_view path) -> std::optional<MappedFile>;
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&) noexcept;
+    MappedFile &operator=(MappedFile &&) noexcept;
+
+    [[nodiscard]] auto data() const noexcept -> const char * { return m_data; }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+
+    [[nodiscard]] auto view() const noexcept -> std::string_view { return {m_data, m_size}; }
+
+private:
+    MappedFile() = default;
+
+    auto release() noexcept -> void;
+
+    const char *m_data{nullptr};
+    std::size_t m_size{0};
+};
+
+} // namespace engine
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "Engine/resources/MappedFile.hpp"
+
+namespace engine {
+
+// note : the RGBA8 pixels of a texture followed by its mipmaps, either decoded from an image
+//        or mapped from the cache (see @AssetCache), in both cases ready to be given to OpenGL
+class Pixels {
+public:
+    static constexpr std::size_t CHANNEL = 4;
+
+    struct Level {
+        std::int32_t width;
+        std::int32_t height;
+        const std::uint8_t *data;
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * CHANNEL;
+        }
+    };
+
+    // note : the content of a png, jpg, ... only the first level is filled
+    static auto decode(const std::string_view content) -> std::optional<Pixels>;
+
+    // note : the levels are read in place, the mapping is owned by the Pixels
+    static auto map(MappedFile &&file, std::size_t offset, std::int32_t width, std::int32_t height, std::size_t levels)
+        -> std::optional<Pixels>;
+
+    // note : halve the last level down to 1x1 with a box filter
+    auto generateMipmaps() -> void;
+
+    [[nodiscard]] auto levels() const noexcept -> const std::vector<Level> & { return m_levels; }
+
+    [[nodiscard]] auto isMipmapped() const noexcept -> bool { return m_levels.size() > 1; }
+
+    [[nodiscard]] auto width() const noexcept -> std::int32_t { return m_levels.front().width; }
+
+    [[nodiscard]] auto height() const noexcept -> std::int32_t { return m_levels.front().height; }
+
+private:
+    Pixels() = default;
+
+    std::optional<MappedFile> m_mapping;
+    std::vector<std::uint8_t> m_storage;
+    std::vector<Level> m_levels;
+};
+
+} // namespace engine
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+namespace engine {
+
+struct CacheStats {
+    std::string_view name;
+
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+    std::uint64_t loads{0};
+    std::uint64_t evictions{0};
+    std::chrono::nanoseconds load_time{0};
+
+    std::size_t count{0};
+    std::size_t bytes{0};
+    std::size_t budget{0}; // note : 0 for no limit
+
+    [[nodiscard]] auto hitRate() const noexcept -> double
+    {
+        const auto total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+
+    [[nodiscard]] auto averageLoad() const noexcept -> std::chrono::microseconds
+    {
+        return loads == 0 ? std::chrono::microseconds{0}
+                          : std::chrono::duration_cast<std::chrono::microseconds>(load_time / loads);
+    }
+};
+
+// note : eviction policy, nothing is released before the cache is cleared
+struct KeepAll {
+    auto advance() noexcept -> void {}
+
+    auto touch(entt::id_type) noexcept -> void {}
+
+    auto erase(entt::id_type) noexcept -> void {}
+
+    [[nodiscard]] auto victim() const noexcept -> std::optional<entt::id_type> { return {}; }
+};
+
+// note : eviction policy, the resource unused for the longest time first
+//        a resource used since the last frame is still on screen and is never chosen
+class LeastRecentlyUsed {
+public:
+    auto advance() noexcept -> void { m_frame++; }
+
+    auto touch(entt::id_type id) -> void
+    {
+        if (const auto found = m_index.find(id); found != m_index.end()) {
+            m_order.splice(m_order.begin(), m_order, found->second);
+            found->second->second = m_frame;
+        } else {
+            m_order.emplace_front(id, m_frame);
+            m_index.emplace(id, m_order.begin());
+        }
+    }
+
+    auto erase(entt::id_type id) -> void
+    {
+        if (const auto found = m_index.find(id); found != m_index.end()) {
+            m_order.erase(found->second);
+            m_index.erase(found);
+        }
+    }
+
+    [[nodiscard]] auto victim() const noexcept -> std::optional<entt::id_type>
+    {
+        if (m_order.empty() || m_order.back().second + 1 >= m_frame) return {};
+        return m_order.back().first;
+    }
+
+private:
+    std::uint64_t m_frame{0};
+
+    // note : the most recently used first, with the frame of its last use
+    std::list<std::pair<entt::id_type, std::uint64_t>> m_order;
+    std::unordered_map<entt::id_type, decltype(m_order)::iterator> m_index;
+};
+
+// note : an entt::resource_cache counting its hits, misses and load time, with an estimation of its memory
+//        over its budget, the resources chosen by the Policy are released (see @ResourceCache::trim)
+template<typename T, typename Policy = KeepAll>
+class ResourceCache {
+public:
+    explicit ResourceCache(std::string_view name, std::size_t budget = 0)
+    {
+        m_stats.name = name;
+        m_stats.budget = budget;
+    }
+
+    // note : in bytes, 0 for no limit
+    auto setBudget(std::size_t budget) noexcept -> void { m_stats.budget = budget; }
+
+    [[nodiscard]] auto contains(entt::id_type id) const -> bool { return m_cache.contains(id); }
+
+    // note : a use of the resource, counted as a hit, the handle is empty if it is not in the cache
+    auto handle(entt::id_type id) -> entt::resource_handle<T>
+    {
+        auto out = m_cache.handle(id);
+        if (out) {
+            m_stats.hits++;
+            m_policy.touch(id);
+        }
+        return out;
+    }
+
+    // note : the handle without counting a use, for the engine itself
+    auto peek(entt::id_type id) -> entt::resource_handle<T> { return m_cache.handle(id); }
+
+    // note : a hit if the resource is in the cache, otherwise a miss and the time spent by the loader is counted
+    template<typename Loader, typename... Args>
+    auto load(entt::id_type id, Args &&... args) -> entt::resource_handle<T>
+    {
+        if (m_cache.contains(id)) return handle(id);
+
+        const auto start = std::chrono::steady_clock::now();
+        auto out = m_cache.template load<Loader>(id, std::forward<Args>(args)...);
+        m_stats.load_time += std::chrono::steady_clock::now() - start;
+
+        m_stats.misses++;
+        m_stats.loads++;
+        if (out) m_policy.touch(id);
+        return out;
+    }
+
+    // note : time spent finishing a resource loaded in the background, by a worker for instance
+    auto record(std::chrono::nanoseconds elapsed) noexcept -> void { m_stats.load_time += elapsed; }
+
+    // note : the estimated memory held by the resource
+    auto resize(entt::id_type id, std::size_t bytes) -> void
+    {
+        if (!m_cache.contains(id)) return;
+
+        auto &size = m_bytes[id];
+        m_stats.bytes = m_stats.bytes - size + bytes;
+        size = bytes;
+    }
+
+    auto discard(entt::id_type id) -> void
+    {
+        if (const auto found = m_bytes.find(id); found != m_bytes.end()) {
+            m_stats.bytes -= found->second;
+            m_bytes.erase(found);
+        }
+        m_policy.erase(id);
+        m_cache.discard(id);
+    }
+
+    auto clear() -> void
+    {
+        m_cache.clear();
+        m_bytes.clear();
+        m_policy = Policy{};
+        m_stats.bytes = 0;
+    }
+
+    // note : once per frame, the released handles are returned so the caller decides when they are destroyed
+    auto trim() -> std::vector<entt::resource_handle<T>>
+    {
+        m_policy.advance();
+
+        std::vector<entt::resource_handle<T>> out;
+        while (m_stats.budget != 0 && m_stats.bytes > m_stats.budget) {
+            const auto victim = m_policy.victim();
+            if (!victim.has_value()) break;
+
+            out.push_back(m_cache.handle(victim.value()));
+            discard(victim.value());
+            m_stats.evictions++;
+        }
+        return out;
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return m_cache.size(); }
+
+    [[nodiscard]] auto stats() const -> CacheStats
+    {
+        auto out = m_stats;
+        out.count = m_cache.size();
+        return out;
+    }
+
+private:
+    entt::resource_cache<T> m_cache;
+    std::unordered_map<entt::id_type, std::size_t> m_bytes;
+    Policy m_policy;
+    CacheStats m_stats;
+};
+
+} // namespace engine
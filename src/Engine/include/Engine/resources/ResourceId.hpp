@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <entt/entt.hpp>
+
+namespace engine {
+
+// note : identify a resource by its path relative to the data folder
+//        the hash is computed at compile time for a literal (see operator""_rid)
+//        and once at load time for a path read from a file (see ResourceId::intern)
+class ResourceId {
+public:
+    constexpr ResourceId() noexcept = default;
+
+    // note : the path must outlive the ResourceId, use this only with a string literal
+    constexpr explicit ResourceId(const std::string_view path) noexcept :
+        m_id{entt::hashed_string::value(path.data(), path.size())}, m_path{path}
+    {
+    }
+
+    // note : the path is copied in a table living until the end of the program,
+    //        nothing is allocated if the path is already known
+    static auto intern(const std::string_view path) -> ResourceId;
+
+    // note : reverse lookup, for debugging purpose
+    static auto name(entt::id_type id) -> std::string_view;
+
+    [[nodiscard]] constexpr auto id() const noexcept -> entt::id_type { return m_id; }
+
+    [[nodiscard]] constexpr auto path() const noexcept -> std::string_view { return m_path; }
+
+    // note : identifier of the same resource loaded with different parameters
+    [[nodiscard]] constexpr auto with(std::uint32_t parameter) const noexcept -> entt::id_type
+    {
+        return parameter == 0 ? m_id : m_id ^ (parameter * 0x9e3779b9u);
+    }
+
+    [[nodiscard]] constexpr operator entt::id_type() const noexcept { return m_id; }
+
+    [[nodiscard]] constexpr auto operator==(const ResourceId &other) const noexcept -> bool { return m_id == other.m_id; }
+
+private:
+    entt::id_type m_id{0};
+    std::string_view m_path{};
+};
+
+} // namespace engine
+
+[[nodiscard]] constexpr auto operator""_rid(const char *str, std::size_t size) noexcept -> engine::ResourceId
+{
+    return engine::ResourceId{std::string_view{str, size}};
+}
@@ -11,16 +11,23 @@
 
 namespace engine {
 
+class Pixels;
+
 struct Texture {
     GLuint id;
 
     std::int32_t width;
     std::int32_t height;
-    std::int32_t channels;
-    std::uint8_t *px;
 
+    // note : load and upload the texture synchronously
     static auto ctor(const std::string_view filepath, bool mirrored_repeated) -> Texture;
 
+    // note : a 1x1 transparent texture, the name stays valid once the real pixels are uploaded
+    static auto placeholder(bool mirrored_repeated) -> Texture;
+
+    // note : the pixels are copied by OpenGL, they can be released once uploaded
+    static auto upload(Texture &texture, const Pixels &pixels) -> void;
+
     static auto dtor(Texture *obj) -> void;
 };
 
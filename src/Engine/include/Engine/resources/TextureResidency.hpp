@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+
+#include <entt/entt.hpp>
+
+#include "Engine/resources/LoaderTexture.hpp"
+#include "Engine/resources/ResourceId.hpp"
+#include "Engine/resources/Texture.hpp"
+
+namespace engine {
+
+// note : the textures released by the cache over its budget are loaded again by their next use
+//        see @AssetLoader::reload
+//        only touched by the main thread
+class TextureResidency {
+public:
+    // note : a released texture may still be drawn by the render thread, it is deleted after this many frames
+    static constexpr std::uint64_t FRAMES_IN_FLIGHT = 3;
+
+    struct Entry {
+        ResourceId resource;
+        bool mirrored_repeated;
+    };
+
+    // note : remember how to load the texture again, the path of the resource must be interned
+    auto track(entt::id_type id, const ResourceId &resource, bool mirrored_repeated) -> void;
+
+    // note : nullptr if the texture has never been requested
+    [[nodiscard]] auto find(entt::id_type id) const noexcept -> const Entry *;
+
+    // note : once per frame, release the least recently used textures over the budget of the cache
+    auto collect(CacheTexture &cache) -> void;
+
+    // note : RGBA8 with its mipmaps
+    static auto estimate(const Texture &texture) noexcept -> std::size_t;
+
+private:
+    std::uint64_t m_frame{0};
+
+    std::unordered_map<entt::id_type, Entry> m_entries;
+
+    std::deque<std::pair<std::uint64_t, entt::resource_handle<Texture>>> m_released;
+};
+
+} // namespace engine
@@ -1,73 +1,69 @@
+#include <stdexcept>
+
 #include <spdlog/spdlog.h>
 #include <stb_image.h>
 
 #include "Engine/Graphics/third_party.hpp"
 
 #include "Engine/component/Drawable.hpp"
-#include "Engine/component/Color.hpp"
 #include "Engine/component/VBOTexture.hpp"
-#include "Engine/resources/LoaderVBOTexture.hpp"
+#include "Engine/component/Spritesheet.hpp"
+#include "Engine/helpers/DrawableFactory.hpp"
+#include "Engine/resources/FileSystem.hpp"
 
 #include "Engine/Core.hpp"
 
-auto engine::Drawable::dtor(const Drawable &drawable) -> void
+auto engine::Spritesheet::from_json(const std::string_view file) -> Spritesheet
 {
-    CALL_OPEN_GL(::glDeleteVertexArrays(1, &drawable.VAO));
-    CALL_OPEN_GL(::glDeleteBuffers(1, &drawable.VBO));
-    CALL_OPEN_GL(::glDeleteBuffers(1, &drawable.EBO));
-}
+    static auto holder = engine::Core::Holder{};
+    const auto &filesystem = holder.instance->getFileSystem();
 
-auto engine::Color::ctor(glm::vec4 &&color) -> Color
-{
-    // clang-format off
-    Color out = {
-        .vertices = {
-            color.r, color.g, color.b, color.a,
-            color.r, color.g, color.b, color.a,
-            color.r, color.g, color.b, color.a,
-            color.r, color.g, color.b, color.a,
-        }};
-    // clang-format on
+    const auto content = filesystem.read(file);
+    if (!content.has_value()) throw std::runtime_error(fmt::format("could not open '{}'", file));
+    const auto json = nlohmann::json::parse(content->view());
+    auto out = json.get<Spritesheet>();
 
-    CALL_OPEN_GL(::glGenBuffers(1, &out.VBO));
+    // note : the frames never change once loaded, so the clip rectangles are computed only once
+    //        only the header of the image is read, so this can be done by any thread // see @AssetLoader
+    for (auto &animation : out.animations) {
+        const auto size = imageSize(animation.file);
+        if (!size.has_value()) {
+            spdlog::error("could not compute the frames of the animation '{}' in {}", animation.name, file);
+            continue;
+        }
+
+        const auto width = static_cast<float>(size.value()[0]);
+        const auto height = static_cast<float>(size.value()[1]);
+        animation.uvs.reserve(animation.frames.size());
+        for (const auto &frame : animation.frames) {
+            animation.uvs.push_back(
+                {static_cast<float>(frame.x) / width,
+                 static_cast<float>(frame.y) / height,
+                 static_cast<float>(animation.width) / width,
+                 static_cast<float>(animation.height) / height});
+        }
+    }
 
     return out;
 }
 
-auto engine::Color::dtor(Color *color) -> void { CALL_OPEN_GL(::glDeleteBuffers(1, &color->VBO)); }
-
-auto engine::VBOTexture::ctor(const std::string_view path, bool mirrored_repeated, const std::array<float, 4ul> &clip)
-    -> VBOTexture
+auto engine::Spritesheet::imageSize(const std::string_view file) -> std::optional<std::array<std::int32_t, 2>>
 {
-    // clang-format off
-    VBOTexture out = {
-        .vertices = {
-            clip[0],             clip[1] + clip[3],   // top left
-            clip[0] + clip[2],   clip[1] + clip[3],   // top right
-            clip[0],             clip[1],             // bottom left
-            clip[0] + clip[2],   clip[1],             // bottom right
-        },
-        .VBO = 0,
-        .id = 0,
-        .mirrored = false,
-    };
-    // clang-format on
-
-    CALL_OPEN_GL(::glGenBuffers(1, &out.VBO));
+    static auto holder = engine::Core::Holder{};
 
-    auto handle = Core::Holder{}.instance->getCache<Texture>().load<LoaderTexture>(
-        entt::hashed_string{fmt::format("resource/texture/identifier/{}_{}", path.data(), mirrored_repeated).data()},
-        path,
-        mirrored_repeated);
-    if (!handle) {
-        spdlog::error("could not load texture in cache !");
-        throw std::runtime_error("could not load texture in cache !");
-    } else {
-        out.id =
-            entt::hashed_string{fmt::format("resource/texture/identifier/{}_{}", path.data(), mirrored_repeated).data()};
+    const auto image = holder.instance->getFileSystem().read(file);
+    std::int32_t width = 0;
+    std::int32_t height = 0;
+    std::int32_t channels = 0;
+    if (!image.has_value()
+        || !::stbi_info_from_memory(
+            reinterpret_cast<const stbi_uc *>(image->data()),
+            static_cast<int>(image->size()),
+            &width,
+            &height,
+            &channels)
+        || width == 0 || height == 0) {
+        return {};
     }
-
-    return out;
+    return std::array{width, height};
 }
-
-auto engine::VBOTexture::dtor(VBOTexture *ptr) -> void { CALL_OPEN_GL(::glDeleteBuffers(1, &ptr->VBO)); }
@@ -1,6 +1,8 @@
 #include <fstream>
 #include <functional>
 #include <filesystem>
+#include <thread>
+#include <utility>
 
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/spdlog.h>
@@ -18,17 +20,23 @@
 #include "Engine/component/Velocity.hpp"
 #include "Engine/component/Acceleration.hpp"
 #include "Engine/component/Hitbox.hpp"
-#include "Engine/component/Source.hpp"
 #include "Engine/component/Color.hpp"
-#include "Engine/component/Spritesheet.hpp"
+#include "Engine/component/AnimationState.hpp"
 #include "Engine/component/VBOTexture.hpp"
 #include "Engine/component/Lifetime.hpp"
 
 #include "Engine/Event/Event.hpp"
-#include "Engine/Graphics/Shader.hpp"
 #include "Engine/Graphics/Window.hpp"
+#include "Engine/Graphics/Renderer.hpp"
+#include "Engine/Graphics/ParticleSystem.hpp"
+#include "Engine/Graphics/DebugDraw.hpp"
+#include "Engine/Graphics/FramePacer.hpp"
+#include "Engine/resources/AssetLoader.hpp"
+#include "Engine/resources/FileSystem.hpp"
+#include "Engine/resources/AssetCache.hpp"
 #include "Engine/Event/JoystickManager.hpp"
 #include "Engine/Options.hpp"
+#include "Engine/TaskGraph.hpp"
 #include "Engine/api/Game.hpp"
 #include "Engine/audio/AudioManager.hpp" // note : should not require this header here
 #include "Engine/Core.hpp"
@@ -40,6 +48,25 @@
 
 using namespace std::chrono_literals;
 
+namespace {
+
+// note : the events coming from the player, the window events are not measured
+auto is_input(const engine::Event &event) -> bool
+{
+    return std::visit(
+        engine::overloaded{
+            [](const std::monostate &) { return false; },
+            [](const engine::OpenWindow &) { return false; },
+            [](const engine::CloseWindow &) { return false; },
+            [](const engine::ResizeWindow &) { return false; },
+            [](const engine::MoveWindow &) { return false; },
+            [](const engine::TimeElapsed &) { return false; },
+            [](const auto &) { return true; }},
+        event);
+}
+
+} // namespace
+
 engine::Core *engine::Core::s_instance{nullptr};
 
 auto engine::Core::Holder::init() noexcept -> Holder
@@ -73,9 +100,13 @@ engine::Core::Core([[maybe_unused]] hidden_type &&)
 
 engine::Core::~Core()
 {
+    // note : the render thread has to be joined while the context and the textures are alive
+    m_renderer.reset(nullptr);
+    m_loader.reset(nullptr);
+    m_particles.reset(nullptr);
     m_textures.clear();
-    m_vbo_textures.clear();
-    m_colors.clear();
+    // note : the window flushes its pending captures, the context must still be alive
+    m_window.reset(nullptr);
 
     ::glfwTerminate();
     ::glfwSetErrorCallback(nullptr);
@@ -105,14 +136,32 @@ try {
 
 auto engine::Core::getNextEvent() -> Event
 {
+    auto polled = FramePacer::clock::now();
     ::glfwPollEvents();
 
     switch (m_eventMode) {
     case EventMode::PAUSED:
     case EventMode::RECORD: {
         m_joystickManager->poll();
-        if (const auto event = m_window->getNextEvent(); event.has_value()) return event.value();
-        if (const auto event = m_joystickManager->getNextEvent(); event.has_value()) return event.value();
+
+        const auto next_event = [&]() -> std::optional<Event> {
+            auto event = m_window->getNextEvent();
+            if (!event.has_value()) event = m_joystickManager->getNextEvent();
+            if (event.has_value() && is_input(event.value())) m_pacer->onInput(polled);
+            return event;
+        };
+
+        if (const auto event = next_event(); event.has_value()) return event.value();
+
+        // note : nothing left to handle, the frame starts once the frame pacer allows it
+        if (m_pacer->wait() && m_pacer->getConfig().late_latch) {
+            polled = FramePacer::clock::now();
+            ::glfwPollEvents();
+            m_joystickManager->poll();
+            if (const auto event = next_event(); event.has_value()) return event.value();
+        }
+
+        m_pacer->beginFrame();
         return TimeElapsed{getElapsedTime()};
     } break;
     case EventMode::PLAYBACK: {
@@ -153,6 +202,8 @@ auto engine::Core::getNextEvent() -> Event
 
 auto engine::Core::main(int argc, char **argv) -> int
 {
+    const auto started = std::chrono::steady_clock::now();
+
     {
 #ifdef LOGLOGLOG
         // todo : setup properly logging
@@ -179,19 +230,50 @@ auto engine::Core::main(int argc, char **argv) -> int
         m_settings = std::move(opt.settings);
     }
 
+    m_filesystem = std::make_unique<FileSystem>(m_settings.data_folder);
+    if (!m_settings.pack.empty()) m_filesystem->mount(m_settings.pack);
+
+    m_asset_cache = std::make_unique<AssetCache>(AssetCache::Config{
+        .folder = m_settings.output_folder + "cache/",
+        .enabled = m_settings.asset_cache,
+        .mipmaps = m_settings.cache_mipmaps,
+    });
+
+    m_audioManager.open(AudioManager::Config{
+        .backend = m_settings.audio_backend,
+        .voices = m_settings.audio_voices,
+        .wav = m_settings.output_folder + "audio.wav",
+        .threaded = m_settings.audio_thread,
+    });
+
     std::uint16_t windowProperty = engine::Window::Property::DEFAULT;
     if (m_settings.fullscreen) windowProperty |= engine::Window::Property::FULLSCREEN;
 
+    m_pacer = std::make_unique<FramePacer>(FramePacer::Config{
+        .mode = FramePacer::parse(m_settings.frame_pacing),
+        .fps = m_settings.frame_cap,
+        .late_latch = m_settings.late_latch,
+    });
+
     this->window(glm::ivec2{m_settings.window_width, m_settings.window_height}, VERSION, windowProperty);
 
     if (m_window == nullptr || m_game == nullptr) { return 1; }
 
-    m_shader_colored.reset(new Shader{Shader::fromFile(
-        m_settings.data_folder + "shaders/colored.vert.glsl", m_settings.data_folder + "shaders/colored.frag.glsl")});
-
-    m_shader_colored_textured.reset(new Shader{Shader::fromFile(
-        m_settings.data_folder + "shaders/colored_textured.vert.glsl",
-        m_settings.data_folder + "shaders/colored_textured.frag.glsl")});
+    m_textures.setBudget(static_cast<std::size_t>(m_settings.texture_budget) * 1024 * 1024);
+    m_loader = std::make_unique<AssetLoader>(m_settings.data_folder, m_settings.loader_threads);
+
+    // note : the independent steps of the startup run at the same time, see @api::Game::onCreate
+    m_startup = std::make_unique<TaskGraph>();
+    m_startup->add(
+        "renderer",
+        [this] {
+            m_particles = std::make_unique<ParticleSystem>();
+            m_debug_draw = std::make_unique<DebugDraw>();
+            m_renderer =
+                std::make_unique<Renderer>(*m_window, *m_pacer, m_settings.data_folder, m_settings.render_thread);
+        },
+        {},
+        TaskGraph::MAIN_THREAD);
 
     // todo : add max size buffer ?
     std::vector<Event> eventsProcessed{TimeElapsed{}};
@@ -202,6 +284,12 @@ auto engine::Core::main(int argc, char **argv) -> int
 
     m_game->onCreate(m_world);
 
+    m_startup->run(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+    m_startup->report();
+    m_startup.reset(nullptr);
+
+    auto first_frame = true;
+
     while (isRunning()) {
         const auto event = getNextEvent();
 
@@ -255,7 +343,7 @@ auto engine::Core::main(int argc, char **argv) -> int
                         std::filesystem::create_directories(m_settings.output_folder + "screenshot/");
                         const auto file = fmt::format(
                             m_settings.output_folder + "screenshot/{}.png", time_to_string(std::time(nullptr)));
-                        if (!m_window->screenshot(file)) { spdlog::warn("failed to take a screenshot: {}", file); }
+                        m_window->screenshot(file);
                     } break;
                     default: m_window->applyEvent(key); break;
                     }
@@ -268,15 +356,28 @@ auto engine::Core::main(int argc, char **argv) -> int
                 []([[maybe_unused]] const auto &) {}},
             event);
 
-        if (timeElapsed) { this->tickOnce(std::get<TimeElapsed>(event)); }
+        if (timeElapsed) {
+            this->tickOnce(std::get<TimeElapsed>(event));
+            if (std::exchange(first_frame, false)) {
+                spdlog::info(
+                    "Engine::Core first frame after {:.1f} ms",
+                    std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - started).count());
+            }
+        }
 
         if (!timeElapsed || (timeElapsed && m_eventMode != EventMode::PAUSED)) m_game->onUpdate(m_world, event);
     }
 
-    m_world.view<engine::Drawable>().each(engine::Drawable::dtor);
-
     m_game->onDestroy(m_world);
 
+    if (const auto stats = m_pacer->getStats(); stats.samples != 0) {
+        spdlog::info(
+            "Engine::FramePacer input to present: average {:.2f} ms, max {:.2f} ms over {} inputs",
+            stats.latency_average_ms,
+            stats.latency_max_ms,
+            stats.samples);
+    }
+
 #ifndef NDEBUG
     nlohmann::json serialized(eventsProcessed);
     std::filesystem::create_directories(m_settings.output_folder + "logs/");
@@ -304,6 +405,8 @@ auto engine::Core::tickOnce(const TimeElapsed &t) -> void
             }
         }
 
+        m_particles->update(static_cast<float>(elapsed));
+
         // should have only one entity cooldown
         m_world.view<entt::tag<"screenshake"_hs>, Cooldown>().each([this, elapsed](auto &, auto &cd) {
             if (!cd.is_in_cooldown) return;
@@ -317,43 +420,24 @@ auto engine::Core::tickOnce(const TimeElapsed &t) -> void
             }
         });
 
-        // check if the spritesheet need to update the texture
-        m_world.view<Spritesheet>().each([&elapsed](engine::Spritesheet &sprite) {
-            if (!sprite.cooldown.is_in_cooldown) return;
+        // note : move to the next frame once the frame has been shown long enough
+        m_world.view<AnimationState, VBOTexture>().each([&elapsed](AnimationState &state, VBOTexture &texture) {
+            if (!state.isPlaying()) return;
 
-            if (std::chrono::milliseconds{elapsed} < sprite.cooldown.remaining_cooldown) {
-                sprite.cooldown.remaining_cooldown -= std::chrono::milliseconds{elapsed};
-            } else {
-                sprite.cooldown.remaining_cooldown = std::chrono::milliseconds(0);
-                sprite.cooldown.is_in_cooldown = false;
+            if (std::chrono::milliseconds{elapsed} < state.remaining) {
+                state.remaining -= std::chrono::milliseconds{elapsed};
+                return;
             }
-        });
 
-        // update and reset the cooldown of the spritesheet
-        for (auto &i : m_world.view<Spritesheet>()) {
-            auto &sprite = m_world.get<Spritesheet>(i);
-            if (sprite.cooldown.is_in_cooldown) continue;
-            sprite.cooldown.is_in_cooldown = true;
-            sprite.cooldown.remaining_cooldown = sprite.cooldown.cooldown;
-            sprite.current_frame++;
-            sprite.current_frame %=
-                static_cast<std::uint16_t>(sprite.animations.at(sprite.current_animation).frames.size());
-
-            auto &vbo_texture = m_world.get<VBOTexture>(i);
-            auto &texture = *getCache<Texture>().handle(vbo_texture.id);
-
-            DrawableFactory::fix_texture(
-                m_world,
-                i,
-                m_settings.data_folder + sprite.animations.at(sprite.current_animation).file,
-                false,
-                {static_cast<float>(sprite.animations.at(sprite.current_animation).frames.at(sprite.current_frame).x)
-                     / static_cast<float>(texture.width),
-                 static_cast<float>(sprite.animations.at(sprite.current_animation).frames.at(sprite.current_frame).y)
-                     / static_cast<float>(texture.height),
-                 sprite.animations.at(sprite.current_animation).width / static_cast<float>(texture.width),
-                 sprite.animations.at(sprite.current_animation).height / static_cast<float>(texture.height)});
-        }
+            const auto &animation = state.current();
+            state.remaining = animation.cooldown;
+            if (animation.uvs.empty()) return;
+
+            state.frame++;
+            state.frame %= static_cast<std::uint16_t>(animation.uvs.size());
+
+            texture.clip = animation.uvs[state.frame];
+        });
 
         m_world.view<d2::Velocity, d2::Acceleration>().each([](auto &vel, auto &acc) {
             vel.x += acc.x;
@@ -412,95 +496,101 @@ auto engine::Core::tickOnce(const TimeElapsed &t) -> void
         }
     }
 
-#ifndef NDEBUG
-    for (auto &i : m_world.view<entt::tag<"debug_hitbox"_hs>, Source, d3::Position>()) {
-        auto &source = m_world.get<Source>(i);
-        if (!m_world.valid(source.source))
-            m_world.destroy(i);
-        else {
-            const auto &pos_source = m_world.get<d3::Position>(source.source);
-            auto &pos = m_world.get<d3::Position>(i);
-            pos.x = pos_source.x;
-            pos.y = pos_source.y;
-        }
-    }
-#endif
+    m_time += static_cast<float>(elapsed); // note : elapsed time since the start of the app
+
+    m_loader->update(std::chrono::microseconds{m_settings.upload_budget});
+    m_audioManager.update(t.elapsed);
 
-    m_window->draw([&] {
-        m_game->drawUserInterface(m_world);
+    m_window->newFrame();
+
+    m_game->drawUserInterface(m_world);
 
 #ifndef NDEBUG
-        if (isShowingDebugInfo()) {
-            ImGui::ShowDemoWindow();
-            debugDrawJoystick();
-            debugDrawDisplayOptions();
-        }
+    if (isShowingDebugInfo()) {
+        ImGui::ShowDemoWindow();
+        debugDrawJoystick();
+        debugDrawDisplayOptions();
+        debugDrawFramePacing();
+        debugDrawCaches();
+    }
 #endif
 
-        ImGui::Render();
+    ImGui::Render();
 
-        const auto background = m_game->getBackgroundColor();
+    // note : from here the frame is only read, the renderer never touches the world
+    auto &frame = m_renderer->acquire();
 
-        CALL_OPEN_GL(::glClearColor(background.r, background.g, background.b, background.a));
-        CALL_OPEN_GL(::glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
+    frame.viewport = m_window->getFramebufferSize();
+    frame.background = m_game->getBackgroundColor();
+    frame.view_proj = m_view_proj;
+    frame.shake = m_shake;
+    frame.time = m_time;
+    frame.display_mode = m_displayMode;
+    frame.input = m_pacer->takeInput();
 
-        // todo : add rendering
-        // texture and no color
-        // no texture and no color
+    const auto model_of = [this](auto entity, const d3::Position &pos, const d2::Scale &scale) {
+        auto *rotationComponent = m_world.try_get<d2::Rotation>(entity);
+        auto rotation = rotationComponent ? static_cast<float>(rotationComponent->angle) : 0.f;
 
-        static std::decay_t<decltype(elapsed)> tmp = 0; // note : elapsed time since the start of the app
-        tmp += elapsed;
-
-        m_shader_colored->use();
-        m_shader_colored->setUniform<float>("time", static_cast<float>(tmp));
-        m_world.view<Drawable, Color, d3::Position, d2::Scale>(entt::exclude<VBOTexture>)
-            .each([this](auto entity, auto &drawable, [[maybe_unused]] auto &color, auto &pos, auto &scale) {
-                auto *rotationComponent = m_world.try_get<d2::Rotation>(entity);
-                auto rotation = rotationComponent ? static_cast<float>(rotationComponent->angle) : 0.f;
+        auto model = glm::mat4(1.0f);
+        model = glm::translate(model, glm::vec3{pos.x, pos.y, pos.z});
+        model = glm::rotate(model, rotation, glm::vec3(0.f, 0.f, 1.f));
+        model = glm::scale(model, glm::vec3{scale.x, scale.y, 1.0f});
+        return model;
+    };
 
-                auto model = glm::mat4(1.0f);
-                model = glm::translate(model, glm::vec3{pos.x, pos.y, pos.z});
-                model = glm::rotate(model, rotation, glm::vec3(0.f, 0.f, 1.f));
-                model = glm::scale(model, glm::vec3{scale.x, scale.y, 1.0f});
-                m_shader_colored->setUniform("model", model);
-                CALL_OPEN_GL(::glBindVertexArray(drawable.VAO));
-                CALL_OPEN_GL(::glDrawElements(m_displayMode, 3 * drawable.triangle_count, GL_UNSIGNED_INT, 0));
+    m_world.view<Drawable, Color, d3::Position, d2::Scale>(entt::exclude<VBOTexture>)
+        .each([&](auto entity, auto &, auto &color, auto &pos, auto &scale) {
+            frame.colored.push_back(RenderSnapshot::Sprite{
+                .model = model_of(entity, pos, scale),
+                .color = color.value,
+                .clip = {0.0f, 0.0f, 1.0f, 1.0f},
+                .texture = 0,
+                .mirrored = false,
             });
+        });
 
-        m_shader_colored_textured->use();
-        m_shader_colored_textured->setUniform<float>("time", static_cast<float>(tmp));
-        m_world.view<Drawable, Color, VBOTexture, d3::Position, d2::Scale>().each(
-            [this](auto entity, auto &drawable, [[maybe_unused]] auto &color, auto &texture, auto &pos, auto &scale) {
-                auto *rotationComponent = m_world.try_get<d2::Rotation>(entity);
-                auto rotation = rotationComponent ? static_cast<float>(rotationComponent->angle) : 0.f;
-
-                auto model = glm::mat4(1.0f);
-                model = glm::translate(model, glm::vec3{pos.x, pos.y, pos.z});
-                model = glm::rotate(model, rotation, glm::vec3(0.f, 0.f, 1.f));
-                model = glm::scale(model, glm::vec3{scale.x, scale.y, 1.0f});
-                m_shader_colored_textured->setUniform("model", model);
-                m_shader_colored_textured->setUniform("mirrored", texture.mirrored);
-                CALL_OPEN_GL(::glBindTexture(GL_TEXTURE_2D, getCache<Texture>().handle(texture.id)->id));
-                CALL_OPEN_GL(::glBindVertexArray(drawable.VAO));
-                CALL_OPEN_GL(::glDrawElements(m_displayMode, 3 * drawable.triangle_count, GL_UNSIGNED_INT, 0));
+    m_world.view<Drawable, Color, VBOTexture, d3::Position, d2::Scale>().each(
+        [&](auto entity, auto &, auto &color, auto &texture, auto &pos, auto &scale) {
+            frame.textured.push_back(RenderSnapshot::Sprite{
+                .model = model_of(entity, pos, scale),
+                .color = color.value,
+                .clip = {texture.clip[0], texture.clip[1], texture.clip[2], texture.clip[3]},
+                .texture = m_loader->use(texture.id),
+                .mirrored = texture.mirrored,
             });
-    });
-}
+        });
 
-auto engine::Core::updateView(const glm::mat4 &view) -> void
-{
-    m_shader_colored->use();
-    m_shader_colored->setUniform("viewProj", view);
-    m_shader_colored_textured->use();
-    m_shader_colored_textured->setUniform("viewProj", view);
+    frame.particle_count = m_particles->write(frame.particles);
+
+#ifndef NDEBUG
+    if (m_show_hitboxes) {
+        const auto draw_hitbox = [this](const d3::Position &pos, const auto &hitbox, const glm::vec4 &color) {
+            m_debug_draw->rectangle(
+                glm::vec2{static_cast<float>(pos.x), static_cast<float>(pos.y)},
+                glm::vec2{static_cast<float>(hitbox.width), static_cast<float>(hitbox.height)},
+                color);
+        };
+
+        m_world.view<d3::Position, d2::HitboxSolid>().each(
+            [&](auto &pos, auto &hitbox) { draw_hitbox(pos, hitbox, {1.0f, 0.0f, 0.0f, 1.0f}); });
+        m_world.view<d3::Position, d2::HitboxFloat>().each(
+            [&](auto &pos, auto &hitbox) { draw_hitbox(pos, hitbox, {0.0f, 1.0f, 0.0f, 1.0f}); });
+    }
+#endif
+
+    frame.debug_vertex_count = m_debug_draw->write(frame.debug_lines);
+
+    frame.setUserInterface(ImGui::GetDrawData());
+
+    m_renderer->submit();
 }
 
+auto engine::Core::updateView(const glm::mat4 &view) -> void { m_view_proj = view; }
+
 auto engine::Core::setScreenshake(bool value, std::chrono::milliseconds delay) -> void
 {
-    m_shader_colored->use();
-    m_shader_colored->setUniform<bool>("shake", value);
-    m_shader_colored_textured->use();
-    m_shader_colored_textured->setUniform<bool>("shake", value);
+    m_shake = value;
 
     if (value) {
         m_world.view<entt::tag<"screenshake"_hs>, Cooldown>().each([&delay](auto &, auto &cd) {
@@ -517,22 +607,9 @@ auto engine::Core::get() noexcept -> std::unique_ptr<Core> &
     return instance;
 }
 
-template<>
-auto engine::Core::getCache() noexcept -> entt::resource_cache<Color> &
+auto engine::Core::getCacheStats() const -> std::vector<CacheStats>
 {
-    return m_colors;
-}
-
-template<>
-auto engine::Core::getCache() noexcept -> entt::resource_cache<VBOTexture> &
-{
-    return m_vbo_textures;
-}
-
-template<>
-auto engine::Core::getCache() noexcept -> entt::resource_cache<Texture> &
-{
-    return m_textures;
+    return {m_textures.stats(), m_audioManager.stats()};
 }
 
 auto engine::Core::loadOpenGL() -> void
@@ -628,6 +705,52 @@ auto engine::Core::debugDrawDisplayOptions() -> void
         }
         ImGui::EndCombo();
     }
+    ImGui::Checkbox("Show hitboxes", &m_show_hitboxes);
+    ImGui::End();
+}
+
+auto engine::Core::debugDrawFramePacing() -> void
+{
+    static constexpr const char *modes[] = {"vsync", "uncapped", "capped"};
+
+    const auto stats = m_pacer->getStats();
+
+    ImGui::Begin("Frame Pacing");
+    helper::ImGui::Text("mode = {}", modes[static_cast<std::size_t>(m_pacer->getConfig().mode)]);
+    helper::ImGui::Text("late latch = {}", m_pacer->getConfig().late_latch);
+    helper::ImGui::Text("frame = {:.2f} ms", stats.frame_ms);
+    helper::ImGui::Text("input to present = {:.2f} ms", stats.latency_last_ms);
+    helper::ImGui::Text("input to present (average) = {:.2f} ms", stats.latency_average_ms);
+    helper::ImGui::Text("input to present (max) = {:.2f} ms", stats.latency_max_ms);
+    ImGui::End();
+}
+
+auto engine::Core::debugDrawCaches() -> void
+{
+    ImGui::Begin("Resource Caches");
+    helper::ImGui::Text("assets being loaded = {}", m_loader->pending());
+    if (const auto voices = m_audioManager.voices(); voices != nullptr) {
+        helper::ImGui::Text("voices = {} / {}, {} stolen", voices->busy(), voices->size(), voices->stolen());
+    }
+    const auto &events = m_audioManager.events().stats();
+    helper::ImGui::Text(
+        "sound requests = {}, played = {}, merged = {}, throttled = {}",
+        events.requested,
+        events.played,
+        events.merged,
+        events.throttled);
+    for (const auto &stats : getCacheStats()) {
+        ImGui::Separator();
+        helper::ImGui::Text("{} = {} entries", stats.name, stats.count);
+        if (stats.budget != 0) {
+            helper::ImGui::Text("memory = {:.2f} / {:.2f} MiB", stats.bytes / 1048576.0, stats.budget / 1048576.0);
+        } else {
+            helper::ImGui::Text("memory = {:.2f} MiB", stats.bytes / 1048576.0);
+        }
+        helper::ImGui::Text("hits = {}, misses = {} ({:.1f}%)", stats.hits, stats.misses, stats.hitRate() * 100.0);
+        helper::ImGui::Text("loads = {} (average {} us)", stats.loads, stats.averageLoad().count());
+        helper::ImGui::Text("evictions = {}", stats.evictions);
+    }
     ImGui::End();
 }
 
@@ -0,0 +1,56 @@
+#include <cmath>
+#include <numbers>
+
+#include "Engine/Graphics/DebugDraw.hpp"
+
+auto engine::DebugDraw::vertex(const glm::vec2 &position, const glm::vec4 &color) -> void
+{
+    m_vertices.insert(m_vertices.end(), {position.x, position.y, color.r, color.g, color.b, color.a});
+}
+
+auto engine::DebugDraw::line(const glm::vec2 &from, const glm::vec2 &to, const glm::vec4 &color) -> void
+{
+    vertex(from, color);
+    vertex(to, color);
+}
+
+auto engine::DebugDraw::rectangle(const glm::vec2 &center, const glm::vec2 &size, const glm::vec4 &color) -> void
+{
+    const auto half = glm::vec2{size.x / 2.0f, size.y / 2.0f};
+
+    const glm::vec2 corners[] = {
+        {center.x - half.x, center.y - half.y},
+        {center.x + half.x, center.y - half.y},
+        {center.x + half.x, center.y + half.y},
+        {center.x - half.x, center.y + half.y},
+    };
+
+    for (auto i = 0ul; i != std::size(corners); i++) line(corners[i], corners[(i + 1) % std::size(corners)], color);
+}
+
+auto engine::DebugDraw::circle(const glm::vec2 &center, float radius, const glm::vec4 &color, std::uint32_t segments)
+    -> void
+{
+    if (segments < 3) segments = 3;
+
+    const auto step = 2.0f * std::numbers::pi_v<float> / static_cast<float>(segments);
+
+    auto previous = glm::vec2{center.x + radius, center.y};
+    for (auto i = 1u; i <= segments; i++) {
+        const auto angle = step * static_cast<float>(i);
+        const auto next = glm::vec2{center.x + radius * std::cos(angle), center.y + radius * std::sin(angle)};
+        line(previous, next, color);
+        previous = next;
+    }
+}
+
+auto engine::DebugDraw::write(std::vector<float> &vertices) -> std::size_t
+{
+    const auto count = size();
+
+    // note : the buffers are swapped back and forth, so they keep their capacity between the frames
+    vertices.swap(m_vertices);
+    m_vertices.clear();
+
+    return count;
+}
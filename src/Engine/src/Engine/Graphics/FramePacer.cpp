@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <thread>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/Graphics/FramePacer.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr auto kMinSleepMargin = std::chrono::steady_clock::duration{200us};
+constexpr auto kMaxSleepMargin = std::chrono::steady_clock::duration{4ms};
+
+template<typename Duration>
+constexpr auto to_ms(Duration d) -> float
+{
+    return std::chrono::duration<float, std::milli>(d).count();
+}
+
+} // namespace
+
+engine::FramePacer::FramePacer(Config &&config) :
+    m_config{std::move(config)}, m_period{std::chrono::duration_cast<clock::duration>(
+                                     std::chrono::duration<double>{1.0 / std::max(m_config.fps, 1u)})},
+    m_deadline{clock::now()}, m_sleep_margin{1ms}
+{
+    switch (m_config.mode) {
+    case Mode::VSYNC: spdlog::info("Engine::FramePacer vsync"); break;
+    case Mode::UNCAPPED: spdlog::info("Engine::FramePacer uncapped"); break;
+    case Mode::CAPPED: spdlog::info("Engine::FramePacer capped at {} fps", m_config.fps); break;
+    }
+    if (m_config.late_latch) spdlog::info("Engine::FramePacer late latch of the input enabled");
+}
+
+auto engine::FramePacer::parse(const std::string_view mode) -> Mode
+{
+    if (mode == "uncapped") return Mode::UNCAPPED;
+    if (mode == "capped") return Mode::CAPPED;
+    return Mode::VSYNC;
+}
+
+auto engine::FramePacer::wait() -> bool
+{
+    if (m_config.mode != Mode::CAPPED) return false;
+
+    if (clock::now() >= m_deadline) return false;
+
+    // note : the sleep is only as precise as the scheduler, the end of the wait is spun
+    if (const auto target = m_deadline - m_sleep_margin; clock::now() < target) {
+        std::this_thread::sleep_until(target);
+
+        const auto overshoot = clock::now() - target;
+        m_sleep_margin = std::clamp(
+            std::max<clock::duration>(overshoot + 100us, m_sleep_margin * 15 / 16), kMinSleepMargin, kMaxSleepMargin);
+    }
+
+    while (clock::now() < m_deadline) std::this_thread::yield();
+
+    return true;
+}
+
+auto engine::FramePacer::beginFrame() -> void
+{
+    if (m_config.mode != Mode::CAPPED) return;
+
+    const auto now = clock::now();
+    m_deadline += m_period;
+
+    // note : the frame is late, do not try to catch up
+    if (m_deadline < now) m_deadline = now + m_period;
+}
+
+auto engine::FramePacer::onInput(clock::time_point polled) -> void
+{
+    if (!m_input.has_value()) m_input = polled;
+}
+
+auto engine::FramePacer::takeInput() -> std::optional<clock::time_point>
+{
+    auto out = m_input;
+    m_input.reset();
+    return out;
+}
+
+auto engine::FramePacer::onPresent(std::optional<clock::time_point> input) -> void
+{
+    const auto now = clock::now();
+
+    std::lock_guard lock{m_mutex};
+
+    if (m_last_present.has_value()) m_stats.frame_ms = to_ms(now - *m_last_present);
+    m_last_present = now;
+
+    if (!input.has_value()) return;
+
+    const auto latency = to_ms(now - *input);
+    m_stats.samples++;
+    m_stats.latency_last_ms = latency;
+    m_stats.latency_max_ms = std::max(m_stats.latency_max_ms, latency);
+    m_stats.latency_average_ms += (latency - m_stats.latency_average_ms) / static_cast<float>(m_stats.samples);
+}
+
+auto engine::FramePacer::getStats() const -> Stats
+{
+    std::lock_guard lock{m_mutex};
+    return m_stats;
+}
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <utility>
+
+#include "Engine/Graphics/ParticleSystem.hpp"
+
+engine::ParticleSystem::ParticleSystem()
+{
+    for (auto &field : m_pool) field.resize(CAPACITY, 0.0f);
+}
+
+auto engine::ParticleSystem::emit(const Particle &particle) noexcept -> bool
+{
+    if (m_count == CAPACITY) return false;
+
+    const auto i = m_count++;
+    m_pool[X][i] = particle.position.x;
+    m_pool[Y][i] = particle.position.y;
+    m_pool[Z][i] = particle.position.z;
+    m_pool[VX][i] = particle.velocity.x;
+    m_pool[VY][i] = particle.velocity.y;
+    m_pool[SIZE][i] = particle.size;
+    m_pool[R][i] = particle.color.r;
+    m_pool[G][i] = particle.color.g;
+    m_pool[B][i] = particle.color.b;
+    m_pool[A][i] = particle.color.a;
+    m_pool[DR][i] = particle.fade.r;
+    m_pool[DG][i] = particle.fade.g;
+    m_pool[DB][i] = particle.fade.b;
+    m_pool[DA][i] = particle.fade.a;
+    m_pool[JITTER][i] = particle.jitter;
+    m_pool[LIFE][i] = particle.lifetime;
+
+    return true;
+}
+
+auto engine::ParticleSystem::update(float elapsed_ms) noexcept -> void
+{
+    const auto count = m_count;
+    const auto tick = m_tick++;
+
+    auto *__restrict x = m_pool[X].data();
+    auto *__restrict y = m_pool[Y].data();
+    auto *__restrict vx = m_pool[VX].data();
+    auto *__restrict vy = m_pool[VY].data();
+    auto *__restrict jitter = m_pool[JITTER].data();
+    auto *__restrict life = m_pool[LIFE].data();
+
+    // note : no branch and no call in the loops, so they can be vectorized
+    for (std::size_t i = 0; i != count; i++) {
+        // note : cheap integer hash instead of std::rand, to get the direction of the jitter
+        auto h = static_cast<std::uint32_t>(i) * 0x9e3779b9u + tick * 0x85ebca6bu;
+        h ^= h >> 15;
+        h *= 0x2c1b3c6du;
+        h ^= h >> 12;
+        const auto sx = static_cast<float>(h & 1u) * 2.0f - 1.0f;
+        const auto sy = static_cast<float>((h >> 1) & 1u) * 2.0f - 1.0f;
+
+        vx[i] += sx * jitter[i] * elapsed_ms;
+        vy[i] += sy * jitter[i] * elapsed_ms;
+        x[i] += vx[i] * elapsed_ms / 1000.0f;
+        y[i] += vy[i] * elapsed_ms / 1000.0f;
+        life[i] -= elapsed_ms;
+    }
+
+    for (const auto &[channel, fade] : {std::pair{R, DR}, std::pair{G, DG}, std::pair{B, DB}, std::pair{A, DA}}) {
+        auto *__restrict c = m_pool[channel].data();
+        const auto *__restrict d = m_pool[fade].data();
+        for (std::size_t i = 0; i != count; i++) c[i] = std::clamp(c[i] + d[i] * elapsed_ms, 0.0f, 1.0f);
+    }
+
+    // note : the dead particles are replaced by the last alive one, the order does not matter
+    for (std::size_t i = 0; i < m_count;) {
+        if (life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        m_count--;
+        for (auto &field : m_pool) field[i] = field[m_count];
+    }
+}
+
+auto engine::ParticleSystem::write(std::vector<float> &instances) const -> std::size_t
+{
+    instances.resize(CAPACITY * INSTANCE_STRIDE);
+
+    constexpr std::array<Field, INSTANCE_STRIDE> layout{X, Y, Z, SIZE, R, G, B, A};
+    for (std::size_t f = 0; f != layout.size(); f++) {
+        const auto *__restrict src = m_pool[layout[f]].data();
+        auto *__restrict dst = instances.data() + f;
+        for (std::size_t i = 0; i != m_count; i++) dst[i * INSTANCE_STRIDE] = src[i];
+    }
+
+    return m_count;
+}
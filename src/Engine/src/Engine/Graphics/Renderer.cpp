@@ -0,0 +1,315 @@
+#include <spdlog/spdlog.h>
+
+#include "Engine/Graphics/third_party.hpp"
+
+#include "Engine/Graphics/Shader.hpp"
+#include "Engine/Graphics/Window.hpp"
+#include "Engine/Graphics/ParticleSystem.hpp"
+#include "Engine/Graphics/DebugDraw.hpp"
+#include "Engine/Graphics/FramePacer.hpp"
+#include "Engine/Graphics/Renderer.hpp"
+
+engine::RenderSnapshot::RenderSnapshot() : ui{std::make_unique<ImDrawData>()} {}
+
+engine::RenderSnapshot::~RenderSnapshot() { clear(); }
+
+auto engine::RenderSnapshot::clear() -> void
+{
+    colored.clear();
+    textured.clear();
+    particle_count = 0;
+    debug_vertex_count = 0;
+    input.reset();
+
+    for (auto &list : ui_lists) IM_DELETE(list);
+    ui_lists.clear();
+    ui->Clear();
+
+    if (fence != nullptr) {
+        ::glDeleteSync(static_cast<GLsync>(fence));
+        fence = nullptr;
+    }
+}
+
+auto engine::RenderSnapshot::setUserInterface(const ImDrawData *data) -> void
+{
+    if (data == nullptr || !data->Valid) return;
+
+    for (auto i = 0; i != data->CmdListsCount; i++) ui_lists.push_back(data->CmdLists[i]->CloneOutput());
+
+    ui->Valid = true;
+    ui->CmdLists = ui_lists.data();
+    ui->CmdListsCount = data->CmdListsCount;
+    ui->TotalIdxCount = data->TotalIdxCount;
+    ui->TotalVtxCount = data->TotalVtxCount;
+    ui->DisplayPos = data->DisplayPos;
+    ui->DisplaySize = data->DisplaySize;
+    ui->FramebufferScale = data->FramebufferScale;
+}
+
+engine::Renderer::Renderer(Window &window, FramePacer &pacer, const std::string &data_folder, bool threaded) :
+    m_window{window}, m_pacer{pacer}, m_threaded{threaded}
+{
+    // note : the programs are shared between the contexts, they can be created here
+    m_shader_colored.reset(new Shader{Shader::fromFile(
+        data_folder + "shaders/colored.vert.glsl", data_folder + "shaders/colored.frag.glsl")});
+
+    m_shader_colored_textured.reset(new Shader{Shader::fromFile(
+        data_folder + "shaders/colored_textured.vert.glsl", data_folder + "shaders/colored_textured.frag.glsl")});
+
+    m_shader_particle.reset(new Shader{
+        Shader::fromFile(data_folder + "shaders/particle.vert.glsl", data_folder + "shaders/colored.frag.glsl")});
+
+    m_shader_debug.reset(new Shader{
+        Shader::fromFile(data_folder + "shaders/debug.vert.glsl", data_folder + "shaders/colored.frag.glsl")});
+
+    if (!m_threaded) {
+        createVertexArrays();
+        return;
+    }
+
+    spdlog::info("Engine::Renderer drawing on a dedicated thread");
+
+    // note : the simulation keeps a hidden context sharing the resources of the window
+    m_window.setLoaderActive();
+
+    m_thread = std::thread{[this] {
+        m_window.setActive();
+        createVertexArrays();
+
+        while (true) {
+            std::size_t index;
+            {
+                std::unique_lock lock{m_mutex};
+                m_cv.wait(lock, [this] { return m_stop || m_pending.has_value(); });
+                if (!m_pending.has_value()) break;
+                index = *m_pending;
+                m_drawing = index;
+                m_pending.reset();
+            }
+            m_cv.notify_all();
+
+            draw(m_snapshots[index]);
+
+            {
+                std::lock_guard lock{m_mutex};
+                m_drawing.reset();
+            }
+            m_cv.notify_all();
+        }
+
+        deleteVertexArrays();
+        ::glfwMakeContextCurrent(nullptr);
+    }};
+}
+
+engine::Renderer::~Renderer()
+{
+    if (m_threaded) {
+        {
+            std::unique_lock lock{m_mutex};
+            m_cv.wait(lock, [this] { return !m_pending.has_value() && !m_drawing.has_value(); });
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+
+        // note : the window takes back its context, the remaining resources are released with it
+        m_window.setActive();
+    } else {
+        deleteVertexArrays();
+    }
+
+    for (auto &snapshot : m_snapshots) snapshot.clear();
+}
+
+auto engine::Renderer::acquire() -> RenderSnapshot &
+{
+    if (m_threaded) {
+        std::unique_lock lock{m_mutex};
+        m_cv.wait(lock, [this] { return m_drawing != m_write && m_pending != m_write; });
+    }
+
+    auto &out = m_snapshots[m_write];
+    out.clear();
+    return out;
+}
+
+auto engine::Renderer::submit() -> void
+{
+    auto &snapshot = m_snapshots[m_write];
+
+    if (!m_threaded) {
+        draw(snapshot);
+        return;
+    }
+
+    // note : the textures uploaded by the simulation must be complete before the renderer uses them
+    snapshot.fence = ::glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    CALL_OPEN_GL(::glFlush());
+
+    {
+        std::unique_lock lock{m_mutex};
+        m_cv.wait(lock, [this] { return !m_pending.has_value(); });
+        m_pending = m_write;
+        m_write = (m_write + 1) % m_snapshots.size();
+    }
+    m_cv.notify_all();
+}
+
+auto engine::Renderer::draw(RenderSnapshot &snapshot) -> void
+{
+    if (snapshot.fence != nullptr) ::glWaitSync(static_cast<GLsync>(snapshot.fence), 0, GL_TIMEOUT_IGNORED);
+
+    CALL_OPEN_GL(::glViewport(0, 0, snapshot.viewport.x, snapshot.viewport.y));
+    CALL_OPEN_GL(::glClearColor(snapshot.background.r, snapshot.background.g, snapshot.background.b, snapshot.background.a));
+    CALL_OPEN_GL(::glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
+
+    for (auto *shader :
+         {m_shader_colored.get(), m_shader_colored_textured.get(), m_shader_particle.get(), m_shader_debug.get()}) {
+        shader->use();
+        shader->setUniform("viewProj", snapshot.view_proj);
+        shader->setUniform<bool>("shake", snapshot.shake);
+        shader->setUniform<float>("time", snapshot.time);
+    }
+
+    CALL_OPEN_GL(::glBindVertexArray(m_quad_VAO));
+
+    m_shader_colored->use();
+    for (const auto &sprite : snapshot.colored) {
+        m_shader_colored->setUniform("model", sprite.model);
+        m_shader_colored->setUniform("color", sprite.color);
+        CALL_OPEN_GL(::glDrawElements(snapshot.display_mode, 6, GL_UNSIGNED_INT, 0));
+    }
+
+    m_shader_colored_textured->use();
+    for (const auto &sprite : snapshot.textured) {
+        m_shader_colored_textured->setUniform("model", sprite.model);
+        m_shader_colored_textured->setUniform("mirrored", sprite.mirrored);
+        m_shader_colored_textured->setUniform("color", sprite.color);
+        m_shader_colored_textured->setUniform("clip", sprite.clip);
+        CALL_OPEN_GL(::glBindTexture(GL_TEXTURE_2D, sprite.texture));
+        CALL_OPEN_GL(::glDrawElements(snapshot.display_mode, 6, GL_UNSIGNED_INT, 0));
+    }
+
+    if (snapshot.particle_count != 0) {
+        m_shader_particle->use();
+        CALL_OPEN_GL(::glBindVertexArray(m_particle_VAO));
+        CALL_OPEN_GL(::glBindBuffer(GL_ARRAY_BUFFER, m_particle_VBO));
+        // note : orphan the previous storage, the driver does not have to wait for the last draw
+        CALL_OPEN_GL(::glBufferData(
+            GL_ARRAY_BUFFER,
+            static_cast<GLsizeiptr>(ParticleSystem::CAPACITY * ParticleSystem::INSTANCE_STRIDE * sizeof(float)),
+            nullptr,
+            GL_STREAM_DRAW));
+        CALL_OPEN_GL(::glBufferSubData(
+            GL_ARRAY_BUFFER,
+            0,
+            static_cast<GLsizeiptr>(snapshot.particle_count * ParticleSystem::INSTANCE_STRIDE * sizeof(float)),
+            snapshot.particles.data()));
+        CALL_OPEN_GL(::glDrawElementsInstanced(
+            snapshot.display_mode, 6, GL_UNSIGNED_INT, 0, static_cast<GLsizei>(snapshot.particle_count)));
+    }
+
+    if (snapshot.debug_vertex_count != 0) {
+        m_shader_debug->use();
+        CALL_OPEN_GL(::glBindVertexArray(m_debug_VAO));
+        CALL_OPEN_GL(::glBindBuffer(GL_ARRAY_BUFFER, m_debug_VBO));
+        CALL_OPEN_GL(::glBufferData(
+            GL_ARRAY_BUFFER,
+            static_cast<GLsizeiptr>(snapshot.debug_vertex_count * DebugDraw::VERTEX_STRIDE * sizeof(float)),
+            snapshot.debug_lines.data(),
+            GL_STREAM_DRAW));
+        // note : always on top of the sprites
+        CALL_OPEN_GL(::glDisable(GL_DEPTH_TEST));
+        CALL_OPEN_GL(::glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(snapshot.debug_vertex_count)));
+        CALL_OPEN_GL(::glEnable(GL_DEPTH_TEST));
+    }
+
+    CALL_OPEN_GL(::glBindVertexArray(0));
+
+    if (snapshot.ui->Valid) ImGui_ImplOpenGL3_RenderDrawData(snapshot.ui.get());
+
+    m_window.render();
+
+    m_pacer.onPresent(snapshot.input);
+}
+
+auto engine::Renderer::createVertexArrays() -> void
+{
+    // clang-format off
+    static constexpr float vertices[] = {
+    //  position               texture
+        -0.5f, -0.5f, 1.0f,    0.0f, 1.0f, // top left
+        +0.5f, -0.5f, 1.0f,    1.0f, 1.0f, // top right
+        -0.5f, +0.5f, 1.0f,    0.0f, 0.0f, // bottom left
+        +0.5f, +0.5f, 1.0f,    1.0f, 0.0f, // bottom right
+    };
+    static constexpr std::uint32_t indices[] = {
+        0, 1, 2, // first triangle
+        1, 2, 3, // second triangle
+    };
+    // clang-format on
+
+    CALL_OPEN_GL(::glGenBuffers(1, &m_quad_VBO));
+    CALL_OPEN_GL(::glBindBuffer(GL_ARRAY_BUFFER, m_quad_VBO));
+    CALL_OPEN_GL(::glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW));
+
+    CALL_OPEN_GL(::glGenBuffers(1, &m_quad_EBO));
+
+    CALL_OPEN_GL(::glGenVertexArrays(1, &m_quad_VAO));
+    CALL_OPEN_GL(::glBindVertexArray(m_quad_VAO));
+    CALL_OPEN_GL(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quad_EBO));
+    CALL_OPEN_GL(::glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW));
+    CALL_OPEN_GL(::glBindBuffer(GL_ARRAY_BUFFER, m_quad_VBO));
+    CALL_OPEN_GL(::glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), static_cast<void *>(0)));
+    CALL_OPEN_GL(::glEnableVertexAttribArray(0));
+    CALL_OPEN_GL(::glVertexAttribPointer(
+        2, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), reinterpret_cast<void *>(3 * sizeof(float))));
+    CALL_OPEN_GL(::glEnableVertexAttribArray(2));
+
+    constexpr auto stride = static_cast<GLsizei>(ParticleSystem::INSTANCE_STRIDE * sizeof(float));
+
+    CALL_OPEN_GL(::glGenBuffers(1, &m_particle_VBO));
+
+    CALL_OPEN_GL(::glGenVertexArrays(1, &m_particle_VAO));
+    CALL_OPEN_GL(::glBindVertexArray(m_particle_VAO));
+    CALL_OPEN_GL(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quad_EBO));
+    CALL_OPEN_GL(::glBindBuffer(GL_ARRAY_BUFFER, m_quad_VBO));
+    CALL_OPEN_GL(::glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), static_cast<void *>(0)));
+    CALL_OPEN_GL(::glEnableVertexAttribArray(0));
+    CALL_OPEN_GL(::glBindBuffer(GL_ARRAY_BUFFER, m_particle_VBO));
+    CALL_OPEN_GL(::glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, static_cast<void *>(0)));
+    CALL_OPEN_GL(::glEnableVertexAttribArray(3));
+    CALL_OPEN_GL(::glVertexAttribDivisor(3, 1));
+    CALL_OPEN_GL(
+        ::glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void *>(4 * sizeof(float))));
+    CALL_OPEN_GL(::glEnableVertexAttribArray(4));
+    CALL_OPEN_GL(::glVertexAttribDivisor(4, 1));
+
+    constexpr auto debug_stride = static_cast<GLsizei>(DebugDraw::VERTEX_STRIDE * sizeof(float));
+
+    CALL_OPEN_GL(::glGenBuffers(1, &m_debug_VBO));
+
+    CALL_OPEN_GL(::glGenVertexArrays(1, &m_debug_VAO));
+    CALL_OPEN_GL(::glBindVertexArray(m_debug_VAO));
+    CALL_OPEN_GL(::glBindBuffer(GL_ARRAY_BUFFER, m_debug_VBO));
+    CALL_OPEN_GL(::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, debug_stride, static_cast<void *>(0)));
+    CALL_OPEN_GL(::glEnableVertexAttribArray(0));
+    CALL_OPEN_GL(
+        ::glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, debug_stride, reinterpret_cast<void *>(2 * sizeof(float))));
+    CALL_OPEN_GL(::glEnableVertexAttribArray(4));
+
+    CALL_OPEN_GL(::glBindVertexArray(0));
+}
+
+auto engine::Renderer::deleteVertexArrays() -> void
+{
+    CALL_OPEN_GL(::glDeleteVertexArrays(1, &m_quad_VAO));
+    CALL_OPEN_GL(::glDeleteVertexArrays(1, &m_particle_VAO));
+    CALL_OPEN_GL(::glDeleteVertexArrays(1, &m_debug_VAO));
+    CALL_OPEN_GL(::glDeleteBuffers(1, &m_quad_VBO));
+    CALL_OPEN_GL(::glDeleteBuffers(1, &m_quad_EBO));
+    CALL_OPEN_GL(::glDeleteBuffers(1, &m_particle_VBO));
+    CALL_OPEN_GL(::glDeleteBuffers(1, &m_debug_VBO));
+}
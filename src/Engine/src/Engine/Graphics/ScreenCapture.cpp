@@ -0,0 +1,229 @@
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <stb_image_write.h>
+
+#include "Engine/Graphics/third_party.hpp"
+#include "Engine/Graphics/ScreenCapture.hpp"
+
+namespace {
+
+constexpr auto CHANNEL = 4;
+
+} // namespace
+
+engine::ScreenCapture::ScreenCapture(Config &&config) : m_config{std::move(config)}, m_ring(kRingSize, 0u)
+{
+    m_config.queue = std::max<std::size_t>(m_config.queue, 1);
+    m_config.threads = std::max<std::size_t>(m_config.threads, 1);
+
+    if (isRecording()) {
+        std::filesystem::create_directories(m_config.folder);
+        spdlog::info(
+            "Engine::ScreenCapture recording one frame every {} frames in '{}'", m_config.every, m_config.folder);
+    }
+
+    // note : GL_STREAM_READ without persistent mapping, so it also runs on Mesa software rasterizer
+    CALL_OPEN_GL(::glGenBuffers(static_cast<GLsizei>(m_ring.size()), m_ring.data()));
+
+    for (auto i = 0ul; i != m_config.threads; i++) {
+        m_workers.emplace_back([this] {
+            while (true) {
+                Job job;
+                {
+                    std::unique_lock lock{m_mutex};
+                    m_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                    if (m_jobs.empty()) return;
+                    job = std::move(m_jobs.front());
+                    m_jobs.pop_front();
+                    m_encoding++;
+                }
+                m_cv.notify_all();
+
+                encode(std::move(job));
+
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_encoding--;
+                }
+                m_cv.notify_all();
+            }
+        });
+    }
+}
+
+engine::ScreenCapture::~ScreenCapture()
+{
+    flush();
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto &worker : m_workers) worker.join();
+
+    CALL_OPEN_GL(::glDeleteBuffers(static_cast<GLsizei>(m_ring.size()), m_ring.data()));
+}
+
+auto engine::ScreenCapture::request(const std::string_view filename) -> void
+{
+    std::lock_guard lock{m_requests_mutex};
+    m_requests.emplace_back(filename);
+}
+
+auto engine::ScreenCapture::update() -> void
+{
+    std::vector<std::string> requests;
+    {
+        std::lock_guard lock{m_requests_mutex};
+        requests.swap(m_requests);
+    }
+    for (auto &filename : requests) readback(std::move(filename), Format::PNG, GL_BACK);
+
+    if (isRecording() && m_frame % m_config.every == 0) {
+        readback(
+            fmt::format(
+                "{}{:08}.{}", m_config.folder, m_frame / m_config.every, m_config.format == Format::PNG ? "png" : "rgba"),
+            m_config.format,
+            GL_BACK);
+    }
+
+    while (!m_pending.empty()) {
+        auto &next = m_pending.front();
+        if (!map(next, m_frame - next.frame >= kMaxLatency)) break;
+        m_pending.pop_front();
+    }
+
+    m_frame++;
+}
+
+auto engine::ScreenCapture::flush() -> void
+{
+    // note : requested after the last frame, the frame on screen is the one to capture
+    std::vector<std::string> requests;
+    {
+        std::lock_guard lock{m_requests_mutex};
+        requests.swap(m_requests);
+    }
+    for (auto &filename : requests) readback(std::move(filename), Format::PNG, GL_FRONT);
+
+    while (!m_pending.empty()) {
+        map(m_pending.front(), true);
+        m_pending.pop_front();
+    }
+
+    std::unique_lock lock{m_mutex};
+    m_cv.wait(lock, [this] { return m_jobs.empty() && m_encoding == 0; });
+}
+
+auto engine::ScreenCapture::readback(std::string &&filename, Format format, std::uint32_t buffer) -> void
+{
+    // note : every pbo of the ring is in flight, the oldest one has to be consumed first
+    if (m_pending.size() == m_ring.size()) {
+        map(m_pending.front(), true);
+        m_pending.pop_front();
+    }
+
+    GLint viewport[4];
+    CALL_OPEN_GL(::glGetIntegerv(GL_VIEWPORT, viewport));
+
+    Readback out{
+        .pbo = m_ring[m_ring_next],
+        .fence = nullptr,
+        .width = viewport[2],
+        .height = viewport[3],
+        .filename = std::move(filename),
+        .format = format,
+        .frame = m_frame,
+    };
+    m_ring_next = (m_ring_next + 1) % m_ring.size();
+
+    CALL_OPEN_GL(::glBindBuffer(GL_PIXEL_PACK_BUFFER, out.pbo));
+    CALL_OPEN_GL(
+        ::glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(out.width * out.height * CHANNEL), nullptr, GL_STREAM_READ));
+    CALL_OPEN_GL(::glPixelStorei(GL_PACK_ALIGNMENT, 1));
+    CALL_OPEN_GL(::glReadBuffer(static_cast<GLenum>(buffer)));
+    CALL_OPEN_GL(::glReadPixels(viewport[0], viewport[1], out.width, out.height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+    CALL_OPEN_GL(::glReadBuffer(GL_BACK));
+    CALL_OPEN_GL(::glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    out.fence = ::glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    m_pending.push_back(std::move(out));
+}
+
+auto engine::ScreenCapture::map(Readback &readback, bool wait) -> bool
+{
+    const auto fence = static_cast<GLsync>(readback.fence);
+    const auto status = ::glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GL_TIMEOUT_IGNORED : 0);
+    if (status == GL_TIMEOUT_EXPIRED) return false;
+    ::glDeleteSync(fence);
+
+    Job job{
+        .pixels = std::vector<std::uint8_t>(static_cast<std::size_t>(readback.width * readback.height * CHANNEL)),
+        .width = readback.width,
+        .height = readback.height,
+        .filename = std::move(readback.filename),
+        .format = readback.format,
+    };
+
+    CALL_OPEN_GL(::glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo));
+    if (const auto data = ::glMapBufferRange(
+            GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(job.pixels.size()), GL_MAP_READ_BIT);
+        data != nullptr) {
+        std::memcpy(job.pixels.data(), data, job.pixels.size());
+        ::glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        push(std::move(job));
+    } else {
+        spdlog::warn("failed to take a screenshot: {} could not be mapped", job.filename);
+    }
+    CALL_OPEN_GL(::glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    return true;
+}
+
+auto engine::ScreenCapture::push(Job &&job) -> void
+{
+    {
+        // note : backpressure, the frame waits for the encoders instead of dropping a capture
+        std::unique_lock lock{m_mutex};
+        m_cv.wait(lock, [this] { return m_jobs.size() < m_config.queue; });
+        m_jobs.push_back(std::move(job));
+    }
+    m_cv.notify_all();
+}
+
+auto engine::ScreenCapture::encode(Job &&job) -> void
+{
+    const auto stride = static_cast<std::size_t>(job.width * CHANNEL);
+
+    // note : OpenGL gives the rows from the bottom to the top
+    std::vector<std::uint8_t> row(stride);
+    for (auto j = 0; j < job.height / 2; ++j) {
+        auto top = job.pixels.data() + static_cast<std::size_t>(j) * stride;
+        auto bottom = job.pixels.data() + static_cast<std::size_t>(job.height - j - 1) * stride;
+
+        std::memcpy(row.data(), top, stride);
+        std::memcpy(top, bottom, stride);
+        std::memcpy(bottom, row.data(), stride);
+    }
+
+    const auto success = [&] {
+        switch (job.format) {
+        case Format::PNG:
+            return !!::stbi_write_png(job.filename.data(), job.width, job.height, CHANNEL, job.pixels.data(), 0);
+        case Format::RAW: {
+            std::ofstream f{job.filename, std::ios::binary};
+            f.write(reinterpret_cast<const char *>(job.pixels.data()), static_cast<std::streamsize>(job.pixels.size()));
+            return f.good();
+        }
+        default: return false;
+        }
+    }();
+
+    if (!success) { spdlog::warn("failed to take a screenshot: {}", job.filename); }
+}
@@ -10,6 +10,8 @@ DISABLE_WARNING_POP
 
 #include "Engine/Graphics/Shader.hpp"
 #include "Engine/helpers/File.hpp"
+#include "Engine/resources/AssetCache.hpp"
+#include "Engine/Core.hpp"
 
 template<std::size_t type>
 struct shader_ {
@@ -36,14 +38,59 @@ struct shader_ {
     std::uint32_t ID;
 };
 
+namespace {
+
+// note : a program binary is only valid for the driver which produced it, empty if the driver can not give one
+auto driver() -> const std::string &
+{
+    static const auto out = [] {
+        GLint formats = 0;
+        ::glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if (formats == 0) {
+            spdlog::info("Engine::Shader no program binary format, the shaders are always compiled");
+            return std::string{};
+        }
+
+        const auto name = [](GLenum value) { return reinterpret_cast<const char *>(::glGetString(value)); };
+        return fmt::format("{}\n{}\n{}", name(GL_VENDOR), name(GL_RENDERER), name(GL_VERSION));
+    }();
+    return out;
+}
+
+} // namespace
+
 engine::Shader::Shader(const std::string_view vCode, const std::string_view fCode) :
     ID{::glCreateProgram()}
 {
+    static auto holder = Core::Holder{};
+
+    const auto &cache = holder.instance->getAssetCache();
+    const auto &gpu = driver();
+    const auto key = AssetCache::hash(fmt::format("{}\n{}\n{}", gpu, vCode, fCode));
+
+    if (!gpu.empty()) {
+        if (const auto binary = cache.program(key); binary.has_value()) {
+            ::glProgramBinary(ID, binary->format, binary->data.data(), static_cast<GLsizei>(binary->data.size()));
+            // note : a binary refused by the driver is not an error, the program is compiled instead
+            //        the GL_INVALID_ENUM or GL_INVALID_VALUE it raises is cleared, the link status tells the result
+            ::glGetError();
+
+            GLint success = GL_FALSE;
+            CALL_OPEN_GL(::glGetProgramiv(ID, GL_LINK_STATUS, &success));
+            if (success == GL_TRUE) {
+                spdlog::trace("Loaded shader program {} from its binary", ID);
+                return;
+            }
+            spdlog::info("Engine::Shader the binary of program {} is outdated, compiling it again", ID);
+        }
+    }
+
     shader_<GL_VERTEX_SHADER> vertex{vCode.data()};
     shader_<GL_FRAGMENT_SHADER> fragment{fCode.data()};
 
     CALL_OPEN_GL(::glAttachShader(ID, vertex.ID));
     CALL_OPEN_GL(::glAttachShader(ID, fragment.ID));
+    if (!gpu.empty()) CALL_OPEN_GL(::glProgramParameteri(ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
     CALL_OPEN_GL(::glLinkProgram(ID));
 
     GLint success;
@@ -61,9 +108,21 @@ engine::Shader::Shader(const std::string_view vCode, const std::string_view fCod
         CALL_OPEN_GL(::glGetProgramInfoLog(ID, maxLength, &maxLength, errorLog.data()));
 
         spdlog::error("(Failed to link shader program {}, \nError : {}\n", ID, errorLog.data());
-    } else {
-        spdlog::trace("Successfully created shader program {}", ID);
+        return;
     }
+
+    spdlog::trace("Successfully created shader program {}", ID);
+
+    if (gpu.empty()) return;
+
+    GLint length = 0;
+    CALL_OPEN_GL(::glGetProgramiv(ID, GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0) return;
+
+    AssetCache::ProgramBinary binary{.format = 0, .data = std::string(static_cast<std::size_t>(length), '\0')};
+    CALL_OPEN_GL(::glGetProgramBinary(ID, length, &length, &binary.format, binary.data.data()));
+    binary.data.resize(static_cast<std::size_t>(length));
+    cache.storeProgram(key, binary);
 }
 
 engine::Shader::~Shader()
@@ -95,6 +154,13 @@ auto engine::Shader::setUniform(const std::string_view name, float v) -> void
         CALL_OPEN_GL(::glUniform1f(location, v));
 }
 
+template<>
+auto engine::Shader::setUniform(const std::string_view name, glm::vec4 v) -> void
+{
+    if (const auto location = ::glGetUniformLocation(ID, name.data()); location != -1)
+        CALL_OPEN_GL(::glUniform4fv(location, 1, glm::value_ptr(v)));
+}
+
 template<>
 auto engine::Shader::setUniform(const std::string_view name, glm::mat4 mat) -> void
 {
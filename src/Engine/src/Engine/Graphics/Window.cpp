@@ -1,11 +1,12 @@
 #include <spdlog/spdlog.h>
-#include <stb_image_write.h>
 
 #include "Engine/Graphics/third_party.hpp"
 
 #include "Engine/Event/Event.hpp"
 #include "Engine/Graphics/Shader.hpp"
 #include "Engine/Graphics/Window.hpp"
+#include "Engine/Graphics/ScreenCapture.hpp"
+#include "Engine/Graphics/FramePacer.hpp"
 #include "Engine/Event/JoystickManager.hpp"
 #include "Engine/audio/AudioManager.hpp" // note : should not require this header here
 #include "Engine/Settings.hpp"           // note : should not require this header here
@@ -37,13 +38,31 @@ engine::Window::Window(glm::ivec2 &&size, const std::string_view title, std::uin
 
     if (!ImGui_ImplOpenGL3_Init()) { throw std::logic_error("Engine::Window initialization opengl3 failed"); }
 
-    // Vsync
-    ::glfwSwapInterval(1);
+    const auto &settings = Core::Holder{}.instance->settings();
+
+    // note : only the vsync frame pacing relies on the swap // see @FramePacer
+    ::glfwSwapInterval(Core::Holder{}.instance->getFramePacer().getSwapInterval());
     CALL_OPEN_GL(::glEnable(GL_DEPTH_TEST));
 
     CALL_OPEN_GL(::glEnable(GL_BLEND));
     CALL_OPEN_GL(::glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
 
+    m_capture = std::make_unique<ScreenCapture>(ScreenCapture::Config{
+        .every = settings.capture_every,
+        .format = settings.capture_format == "raw" ? ScreenCapture::Format::RAW : ScreenCapture::Format::PNG,
+        .queue = settings.capture_queue,
+        .threads = settings.capture_threads,
+        .folder = settings.output_folder + "capture/",
+    });
+
+    if (settings.render_thread) {
+        // note : hidden context sharing the resources of the window, current on the simulation thread
+        ::glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        m_loader_handle = ::glfwCreateWindow(1, 1, "loader", nullptr, m_handle);
+        ::glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+        if (m_loader_handle == nullptr) { throw std::logic_error("Engine::Window initialization shared context failed"); }
+    }
+
     s_instance = this;
 
     ::glfwSetWindowCloseCallback(m_handle, callback_eventClose);
@@ -62,32 +81,29 @@ engine::Window::Window(glm::ivec2 &&size, const std::string_view title, std::uin
         spdlog::trace("Engine::Window Fullscreen");
         setFullscreen(true);
     }
-
-    CALL_OPEN_GL(::glViewport(0, 0, m_size.x, m_size.y));
 }
 
 engine::Window::~Window()
 {
+    // note : the pending captures need the OpenGL context
+    m_capture.reset(nullptr);
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
 
     ImGui::DestroyContext(m_ui_context);
 
+    if (m_loader_handle != nullptr) { ::glfwDestroyWindow(m_loader_handle); }
     if (m_handle != nullptr) { ::glfwDestroyWindow(m_handle); }
 
     spdlog::trace("Engine::Window destroyed");
 }
 
-auto engine::Window::draw(const std::function<void()> &drawer) -> void
+auto engine::Window::newFrame() -> void
 {
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
-
-    drawer();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-
-    render();
 }
 
 auto engine::Window::getNextEvent() -> std::optional<Event>
@@ -117,35 +133,7 @@ auto engine::Window::setFullscreen(bool fullscreen) -> void
     }
 }
 
-bool engine::Window::screenshot(const std::string_view filename)
-{
-    GLint viewport[4];
-
-    CALL_OPEN_GL(::glGetIntegerv(GL_VIEWPORT, viewport));
-    const auto &x = viewport[0];
-    const auto &y = viewport[1];
-    const auto &width = viewport[2];
-    const auto &height = viewport[3];
-
-    constexpr auto CHANNEL = 4ul;
-    std::vector<char> pixels(static_cast<std::size_t>(width * height) * CHANNEL);
-
-    CALL_OPEN_GL(::glPixelStorei(GL_PACK_ALIGNMENT, 1));
-    CALL_OPEN_GL(::glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
-
-    std::array<char, CHANNEL> pixel;
-    for (auto j = 0; j < height / 2; ++j)
-        for (auto i = 0; i < width; ++i) {
-            const auto top = static_cast<std::size_t>(i + j * width) * pixel.size();
-            const auto bottom = static_cast<std::size_t>(i + (height - j - 1) * width) * pixel.size();
-
-            std::memcpy(pixel.data(), pixels.data() + top, pixel.size());
-            std::memcpy(pixels.data() + top, pixels.data() + bottom, pixel.size());
-            std::memcpy(pixels.data() + bottom, pixel.data(), pixel.size());
-        }
-
-    return !!::stbi_write_png(filename.data(), width, height, 4, pixels.data(), 0);
-}
+auto engine::Window::screenshot(const std::string_view filename) -> void { m_capture->request(filename); }
 
 void engine::Window::setCursorVisible(bool visible) noexcept
 {
@@ -156,14 +144,27 @@ auto engine::Window::isOpen() const -> bool { return ::glfwWindowShouldClose(m_h
 
 auto engine::Window::close() -> void { ::glfwSetWindowShouldClose(m_handle, GLFW_TRUE); }
 
-auto engine::Window::render() -> void { ::glfwSwapBuffers(m_handle); }
+auto engine::Window::render() -> void
+{
+    m_capture->update();
+
+    ::glfwSwapBuffers(m_handle);
+}
 
 auto engine::Window::setActive() -> void { ::glfwMakeContextCurrent(m_handle); }
 
+auto engine::Window::setLoaderActive() -> void { ::glfwMakeContextCurrent(m_loader_handle); }
+
+auto engine::Window::getFramebufferSize() const -> glm::ivec2
+{
+    glm::ivec2 size;
+    ::glfwGetFramebufferSize(m_handle, &size.x, &size.y);
+    return size;
+}
+
 auto engine::Window::setSize(glm::ivec2 &&size) -> void
 {
     ::glfwSetWindowSize(m_handle, size.x, size.y);
-    CALL_OPEN_GL(::glViewport(0, 0, size.x, size.y));
     m_size = size;
 }
 
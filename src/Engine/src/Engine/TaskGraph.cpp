@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/TaskGraph.hpp"
+
+namespace {
+
+template<typename Duration>
+constexpr auto to_ms(Duration d) -> float
+{
+    return std::chrono::duration<float, std::milli>(d).count();
+}
+
+} // namespace
+
+auto engine::TaskGraph::add(
+    std::string_view name, std::function<void()> &&work, std::vector<Id> &&after, Affinity affinity) -> Id
+{
+    const auto id = m_tasks.size();
+    if (std::any_of(after.begin(), after.end(), [id](auto i) { return i >= id; })) {
+        throw std::logic_error(fmt::format("Engine::TaskGraph '{}' depends on a step not added yet", name));
+    }
+
+    m_tasks.push_back(Task{
+        .name = std::string{name},
+        .work = std::move(work),
+        .after = std::move(after),
+        .affinity = affinity,
+    });
+    return id;
+}
+
+auto engine::TaskGraph::run(std::size_t threads) -> void
+{
+    m_threads = std::max<std::size_t>(threads, 1);
+    m_start = clock::now();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Id> ready;
+    std::size_t done = 0;
+    std::exception_ptr error;
+
+    for (auto &task : m_tasks) task.waiting = task.after.size();
+    for (auto id = 0ul; id != m_tasks.size(); id++) {
+        for (const auto i : m_tasks[id].after) m_tasks[i].next.push_back(id);
+        if (m_tasks[id].waiting == 0 && m_tasks[id].affinity == ANY) ready.push_back(id);
+    }
+
+    // note : the caller holds the lock, the worker steps made ready are queued
+    const auto finish = [&](Id id) {
+        done++;
+        for (const auto i : m_tasks[id].next) {
+            if (--m_tasks[i].waiting == 0 && m_tasks[i].affinity == ANY) ready.push_back(i);
+        }
+        cv.notify_all();
+    };
+
+    const auto execute = [&](Id id) {
+        auto &task = m_tasks[id];
+        task.start = clock::now();
+        try {
+            task.work();
+        } catch (...) {
+            std::lock_guard lock{mutex};
+            if (!error) error = std::current_exception();
+        }
+        task.end = clock::now();
+    };
+
+    std::vector<std::thread> workers;
+    for (auto i = 0ul; i != m_threads; i++) {
+        workers.emplace_back([&] {
+            std::unique_lock lock{mutex};
+            while (true) {
+                cv.wait(lock, [&] { return error || done == m_tasks.size() || !ready.empty(); });
+                if (error || done == m_tasks.size()) return;
+
+                const auto id = ready.front();
+                ready.pop_front();
+
+                lock.unlock();
+                execute(id);
+                lock.lock();
+
+                finish(id);
+            }
+        });
+    }
+
+    for (auto id = 0ul; id != m_tasks.size(); id++) {
+        if (m_tasks[id].affinity != MAIN_THREAD) continue;
+        {
+            std::unique_lock lock{mutex};
+            cv.wait(lock, [&] { return error || m_tasks[id].waiting == 0; });
+            if (error) break;
+        }
+
+        execute(id);
+
+        std::lock_guard lock{mutex};
+        finish(id);
+    }
+
+    {
+        std::unique_lock lock{mutex};
+        cv.wait(lock, [&] { return error || done == m_tasks.size(); });
+    }
+    cv.notify_all();
+    for (auto &worker : workers) worker.join();
+
+    m_end = clock::now();
+
+    if (error) std::rethrow_exception(error);
+}
+
+auto engine::TaskGraph::report() const -> void
+{
+    spdlog::info(
+        "Engine::TaskGraph {} steps done in {:.1f} ms on the main thread and {} workers",
+        m_tasks.size(),
+        to_ms(m_end - m_start),
+        m_threads);
+
+    std::vector<const Task *> sorted;
+    for (const auto &task : m_tasks) sorted.push_back(&task);
+    std::sort(sorted.begin(), sorted.end(), [](auto lhs, auto rhs) { return lhs->start < rhs->start; });
+
+    for (const auto task : sorted) {
+        spdlog::info(
+            "    {:<16} {:>8.1f} ms, started at {:>8.1f} ms{}",
+            task->name,
+            to_ms(task->end - task->start),
+            to_ms(task->start - m_start),
+            task->affinity == MAIN_THREAD ? " (main thread)" : "");
+    }
+}
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <stdexcept>
 #include <fmt/format.h>
 #include <spdlog/spdlog.h>
@@ -5,41 +6,88 @@
 #include "Engine/audio/AudioFileBuffer.hpp"
 #include "Engine/audio/WavReader.hpp"
 #include "Engine/audio/AlErrorHandling.hpp"
+#include "Engine/resources/FileSystem.hpp"
+#include "Engine/Core.hpp"
 
-engine::AudioFileBuffer::AudioFileBuffer(const std::string_view path)
+auto engine::AudioFileBuffer::Pcm::decode(const std::string_view path) -> Pcm
 {
-    std::uint8_t channels;
-    std::int32_t sampleRate;
-    std::uint8_t bitsPerSample;
+    auto file = Core::Holder{}.instance->getFileSystem().read(path);
+    if (!file.has_value()) throw std::runtime_error(fmt::format("Could not open audio file '{}'", path));
 
-    struct databuff {
-        ALsizei size;
-        char *data;
+    const auto wav = load_wav(file->view());
+    if (!wav.has_value()) throw std::runtime_error(fmt::format("Could not load wav header of '{}'", path));
 
-        ~databuff() { delete[] data; }
-    } soundData;
-
-    soundData.data = load_wav(path, channels, sampleRate, bitsPerSample, soundData.size);
-    if (!soundData.data) throw std::runtime_error(fmt::format("Could not load audio file '{}'", path));
-
-    alCall(alGenBuffers(1, &m_buffer));
+    return Pcm{
+        .file = std::move(file.value()),
+        .data = wav->samples,
+        .format = AudioFileBuffer::format(wav->channels, wav->bits_per_sample),
+        .sample_rate = wav->sample_rate,
+    };
+}
 
-    ALenum format;
+auto engine::AudioFileBuffer::format(std::uint8_t channels, std::uint8_t bitsPerSample) -> ALenum
+{
     if (channels == 1 && bitsPerSample == 8)
-        format = AL_FORMAT_MONO8;
+        return AL_FORMAT_MONO8;
     else if (channels == 1 && bitsPerSample == 16)
-        format = AL_FORMAT_MONO16;
+        return AL_FORMAT_MONO16;
     else if (channels == 2 && bitsPerSample == 8)
-        format = AL_FORMAT_STEREO8;
+        return AL_FORMAT_STEREO8;
     else if (channels == 2 && bitsPerSample == 16)
-        format = AL_FORMAT_STEREO16;
+        return AL_FORMAT_STEREO16;
     else
         throw std::runtime_error(
             fmt::format("ERROR: unrecognised wave format: {} channels, {} bits per sample", channels, bitsPerSample));
+}
+
+auto engine::AudioFileBuffer::convert(
+    ALenum format, std::string_view data, ALsizei sampleRate, SoftwareMixer::Clip &clip) -> void
+{
+    const auto stereo = format == AL_FORMAT_STEREO8 || format == AL_FORMAT_STEREO16;
+    const auto wide = format == AL_FORMAT_MONO16 || format == AL_FORMAT_STEREO16;
+
+    clip.channels = static_cast<std::uint8_t>(stereo ? 2 : 1);
+    clip.sample_rate = sampleRate;
+
+    // note : 8 bits samples are unsigned, 16 bits samples are signed little endian
+    if (wide) {
+        clip.samples.resize(data.size() / sizeof(std::int16_t));
+        for (auto i = 0ul; i != clip.samples.size(); i++) {
+            std::int16_t sample;
+            std::memcpy(&sample, data.data() + i * sizeof(sample), sizeof(sample));
+            clip.samples[i] = static_cast<float>(sample) / 32768.0f;
+        }
+    } else {
+        clip.samples.resize(data.size());
+        for (auto i = 0ul; i != clip.samples.size(); i++) {
+            clip.samples[i] = (static_cast<float>(static_cast<std::uint8_t>(data[i])) - 128.0f) / 128.0f;
+        }
+    }
+    clip.samples.resize(clip.frames() * clip.channels); // note : drop a truncated frame
+}
+
+engine::AudioFileBuffer::AudioFileBuffer(const std::string_view path, bool software) :
+    AudioFileBuffer{Pcm::decode(path), software}
+{
+}
+
+engine::AudioFileBuffer::AudioFileBuffer(const Pcm &pcm, bool software) : m_size{pcm.data.size()}
+{
+    if (software) {
+        auto &clip = m_clip.emplace();
+        convert(pcm.format, pcm.data, pcm.sample_rate, clip);
+
+        m_size = clip.samples.size() * sizeof(float);
+        return;
+    }
 
+    alCall(alGenBuffers(1, &m_buffer));
 
-    alCall(alBufferData(m_buffer, format, soundData.data, soundData.size, sampleRate));
+    alCall(alBufferData(m_buffer, pcm.format, pcm.data.data(), static_cast<ALsizei>(pcm.data.size()), pcm.sample_rate));
 }
 
 
-engine::AudioFileBuffer::~AudioFileBuffer() { alCall(alDeleteBuffers(1, &m_buffer)); }
+engine::AudioFileBuffer::~AudioFileBuffer()
+{
+    if (m_buffer != 0) alCall(alDeleteBuffers(1, &m_buffer));
+}
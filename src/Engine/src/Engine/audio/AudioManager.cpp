@@ -5,59 +5,116 @@
 #include <spdlog/spdlog.h>
 
 #include "Engine/audio/AlErrorHandling.hpp"
+#include "Engine/Settings.hpp"
+#include "Engine/resources/AssetLoader.hpp"
+#include "Engine/Core.hpp"
 
-engine::AudioManager::AudioManager()
+auto engine::AudioManager::open(const Config &config) -> void
 {
-    m_device = alcOpenDevice(nullptr);
+    if (config.backend == "openal") {
+        m_device = alcOpenDevice(nullptr);
 
-    if (!m_device) {
-        spdlog::warn("Could not open audio device, no audio will be playing");
-        return;
-    }
+        if (m_device) {
+            alcCall(m_device, m_context = alcCreateContext(m_device, nullptr));
+
+            if (!m_context) throw std::runtime_error("Could not create audio context");
 
-    alcCall(m_device, m_context = alcCreateContext(m_device, nullptr));
+            ALboolean success = AL_FALSE;
+            alcCall(m_device, success = alcMakeContextCurrent(m_context));
 
-    if (!m_context) throw std::runtime_error("Could not create audio context");
+            if (success == AL_FALSE) throw std::runtime_error("ERROR: Could not make audio context current");
 
-    ALboolean success = AL_FALSE;
-    alcCall(m_device, success = alcMakeContextCurrent(m_context));
+            m_audio = std::make_unique<AudioThread>(config.voices, nullptr, config.threaded);
+            m_voices = std::make_unique<VoicePool>(*m_audio);
+            return;
+        }
+
+        spdlog::warn("Could not open audio device, the sounds are mixed in software and not heard");
+    }
 
-    if (success == AL_FALSE) throw std::runtime_error("ERROR: Could not make audio context current");
+    m_software = true;
+    m_audio = std::make_unique<AudioThread>(
+        config.voices,
+        std::make_unique<SoftwareMixer>(config.voices, config.backend == "wav" ? config.wav : ""),
+        config.threaded);
+    m_voices = std::make_unique<VoicePool>(*m_audio);
 }
 
 engine::AudioManager::~AudioManager()
 {
+    m_voices.reset(nullptr);
+    m_audio.reset(nullptr); // note : the sources must be deleted before their buffers
+    for (auto &stream : m_streams) stream->close(); // note : even if the user still has references
+    m_audioFileCache.clear();
+
     if (!m_device)
         return;
 
-    for (auto &s : m_currentSounds) s->forceDestroy(); // destroys sounds even if user still have references
-    m_audioFileCache.clear();
-
     alcCall(m_device, alcDestroyContext(m_context));
     alcCloseDevice(m_device);
 }
 
-auto engine::AudioManager::getSound(const std::string &path) -> std::shared_ptr<Sound>
+auto engine::AudioManager::getSound(const ResourceId &path, SoundPriority priority) -> Sound
 {
-    if (!m_device)
-        return Sound::GetEmptySound();
+    if (!m_voices)
+        return {};
+
+    auto buffer = [&] {
+        if (m_audioFileCache.contains(path.id())) return m_audioFileCache.handle(path.id());
+
+        // note : being decoded in the background, only the upload is left
+        auto out = [&] {
+            if (auto pcm = Core::Holder{}.instance->getAssetLoader().takeSound(path); pcm.has_value())
+                return m_audioFileCache.load<AudioFileLoader>(path.id(), pcm.value(), m_software);
+
+            // note : the full path is only built when the file is not yet loaded
+            ResourceId::intern(path.path());
+            return m_audioFileCache.load<AudioFileLoader>(
+                path.id(), Core::Holder{}.instance->settings().data_folder + std::string{path.path()}, m_software);
+        }();
+        m_audioFileCache.resize(path.id(), out->size());
+        return out;
+    }();
+
+    const auto voice = m_voices->acquire(buffer, priority);
+    if (!voice.has_value()) return {};
+
+    return {*m_voices, voice.value()};
+}
 
-    garbageCollectCurrentSounds(); // We should run this method periodically. calling here is the easiest way for now
+auto engine::AudioManager::getMusic(const ResourceId &path) -> std::shared_ptr<MusicStream>
+{
+    // note : without OpenAL device, the stream is mixed in software like the sounds
+    if (!m_audio) return std::make_shared<MusicStream>();
 
-    auto buffer = m_audioFileCache.load<AudioFileLoader>(entt::hashed_string(path.c_str()).value(), path);
+    auto &stream = m_streams.emplace_back(std::make_shared<MusicStream>(std::string{path.path()}));
+    m_audio->post(AudioThread::AddStream{stream.get()});
+    return stream;
+}
 
-    auto sound = std::make_shared<Sound>(buffer->get());
-    m_currentSounds.push_back(sound);
+auto engine::AudioManager::contains(entt::id_type id) const -> bool { return m_audioFileCache.contains(id); }
+
+auto engine::AudioManager::addSound(entt::id_type id, const AudioFileBuffer::Pcm &pcm) -> void
+{
+    if (!m_voices || m_audioFileCache.contains(id)) return;
 
-    return sound;
+    const auto buffer = m_audioFileCache.load<AudioFileLoader>(id, pcm, m_software);
+    m_audioFileCache.resize(id, buffer->size());
 }
 
-void engine::AudioManager::garbageCollectCurrentSounds()
+auto engine::AudioManager::update(std::chrono::nanoseconds elapsed) -> void
 {
-    m_currentSounds.erase(
-        std::remove_if(
-            std::begin(m_currentSounds),
-            std::end(m_currentSounds),
-            [](auto &s) { return s.use_count() == 1 && s->getStatus() != SoundStatus::PLAYING; }),
-        std::end(m_currentSounds));
+    m_events.flush(*this, elapsed);
+
+    if (!m_audio) return;
+
+    m_voices->update();
+    if (m_software) m_audio->post(AudioThread::Advance{elapsed});
+
+    const auto unused = std::partition(
+        std::begin(m_streams), std::end(m_streams), [](const auto &stream) { return stream.use_count() != 1; });
+    for (auto it = unused; it != std::end(m_streams); ++it) m_audio->post(AudioThread::RemoveStream{std::move(*it)});
+    m_streams.erase(unused, std::end(m_streams));
+
+    m_audio->flush();
 }
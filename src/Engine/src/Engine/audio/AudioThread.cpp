@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <cstdlib>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/audio/AudioThread.hpp"
+#include "Engine/audio/AudioFileBuffer.hpp"
+#include "Engine/audio/MusicStream.hpp"
+#include "Engine/audio/AlErrorHandling.hpp"
+#include "Engine/helpers/overloaded.hpp"
+
+namespace {
+
+constexpr auto pack(engine::SoundStatus status, std::uint32_t sequence) noexcept -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(sequence) << 8 | static_cast<std::uint64_t>(status);
+}
+
+} // namespace
+
+engine::AudioThread::AudioThread(std::size_t capacity, std::unique_ptr<SoftwareMixer> mixer, bool threaded) :
+    m_mixer{std::move(mixer)}, m_threaded{threaded}
+{
+    capacity = std::min<std::size_t>(capacity, VoicePool::npos);
+    m_voices.reserve(capacity);
+
+    // note : the limit of the device is only known by reaching it
+    while (m_mixer == nullptr && m_voices.size() != capacity) {
+        ALuint source = 0;
+        while (alGetError() != AL_NO_ERROR) {}
+        alGenSources(1, &source);
+        if (alGetError() != AL_NO_ERROR) break;
+
+        m_voices.push_back(Voice{.source = source});
+    }
+    while (m_mixer != nullptr && m_voices.size() != capacity) {
+        m_voices.push_back(Voice{.source = static_cast<ALuint>(m_voices.size())});
+    }
+
+    m_snapshot = std::make_unique<std::atomic<std::uint64_t>[]>(m_voices.size());
+    for (auto i = 0ul; i != m_voices.size(); i++) m_snapshot[i].store(pack(SoundStatus::INITIAL, 0));
+
+    if (!m_threaded) return;
+
+    spdlog::info("Engine::AudioThread playing the sounds on a dedicated thread");
+    m_thread = std::thread{[this] { run(); }};
+}
+
+engine::AudioThread::~AudioThread()
+{
+    if (m_thread.joinable()) {
+        m_stop = true;
+        m_thread.join();
+    }
+
+    if (m_waits != 0) spdlog::warn("Engine::AudioThread the game thread waited {} times for the queue", m_waits);
+
+    // note : the commands left are dropped, with the buffers and the streams they hold
+    while (m_queue.pop().has_value()) {}
+
+    for (auto &voice : m_voices) {
+        if (m_mixer == nullptr) {
+            alSourceStop(voice.source);
+            alSourcei(voice.source, AL_BUFFER, 0);
+            alDeleteSources(1, &voice.source);
+        }
+        voice.buffer = {};
+    }
+}
+
+auto engine::AudioThread::post(Command &&command) -> void
+{
+    if (m_queue.push(std::move(command))) return;
+
+    m_waits++;
+    if (!m_threaded) flush();
+    while (!m_queue.push(std::move(command))) std::this_thread::yield();
+}
+
+auto engine::AudioThread::flush() -> void
+{
+    if (m_threaded) return;
+
+    drain();
+    tick();
+}
+
+auto engine::AudioThread::snapshot(VoicePool::Index voice) const noexcept -> State
+{
+    const auto value = m_snapshot[voice].load(std::memory_order_acquire);
+    return State{
+        .status = static_cast<SoundStatus>(value & 0xFF),
+        .sequence = static_cast<std::uint32_t>(value >> 8),
+    };
+}
+
+auto engine::AudioThread::run() -> void
+{
+    while (!m_stop) {
+        const auto wake = std::chrono::steady_clock::now() + PERIOD;
+
+        drain();
+        tick();
+
+        std::this_thread::sleep_until(wake);
+    }
+}
+
+auto engine::AudioThread::drain() -> void
+{
+    while (auto command = m_queue.pop()) execute(command.value());
+}
+
+auto engine::AudioThread::execute(Command &command) -> void
+{
+    std::visit(
+        overloaded{
+            [](std::monostate) {},
+            [this](Assign &c) {
+                auto &voice = m_voices[c.voice];
+                voice.sequence = c.sequence;
+                voice.buffer = std::move(c.buffer);
+
+                if (m_mixer != nullptr) return m_mixer->assign(voice.source, voice.buffer->clip());
+
+                // note : back to AL_INITIAL, a stopped source would be released before being played
+                alCall(alSourceRewind(voice.source));
+                alCall(alSourcef(voice.source, AL_PITCH, 1.0f));
+                alCall(alSourcef(voice.source, AL_GAIN, 1.0f));
+                alCall(alSource3f(voice.source, AL_POSITION, 0, 0, 0));
+                alCall(alSource3f(voice.source, AL_VELOCITY, 0, 0, 0));
+                alCall(alSourcei(voice.source, AL_LOOPING, AL_FALSE));
+                alCall(alSourcei(voice.source, AL_BUFFER, static_cast<ALint>(voice.buffer->get())));
+            },
+            [this](Play &c) {
+                auto &voice = m_voices[c.voice];
+                voice.sequence = c.sequence;
+                if (m_mixer != nullptr) return m_mixer->play(voice.source);
+                alCall(alSourcePlay(voice.source));
+            },
+            [this](Stop &c) {
+                auto &voice = m_voices[c.voice];
+                voice.sequence = c.sequence;
+                if (m_mixer != nullptr) return m_mixer->stop(voice.source);
+                alCall(alSourceStop(voice.source));
+            },
+            [this](SetPitch &c) {
+                auto &voice = m_voices[c.voice];
+                voice.sequence = c.sequence;
+                if (m_mixer != nullptr) return m_mixer->setPitch(voice.source, c.pitch);
+                alCall(alSourcef(voice.source, AL_PITCH, c.pitch));
+            },
+            [this](SetGain &c) {
+                auto &voice = m_voices[c.voice];
+                voice.sequence = c.sequence;
+                if (m_mixer != nullptr) return m_mixer->setGain(voice.source, c.gain);
+                alCall(alSourcef(voice.source, AL_GAIN, c.gain));
+            },
+            [this](SetLoop &c) {
+                auto &voice = m_voices[c.voice];
+                voice.sequence = c.sequence;
+                if (m_mixer != nullptr) return m_mixer->setLoop(voice.source, c.loop);
+                alCall(alSourcei(voice.source, AL_LOOPING, c.loop ? AL_TRUE : AL_FALSE));
+            },
+            [this](Release &c) {
+                auto &voice = m_voices[c.voice];
+                voice.sequence = c.sequence;
+                if (m_mixer != nullptr) {
+                    m_mixer->assign(voice.source, nullptr);
+                } else {
+                    alCall(alSourceStop(voice.source));
+                    alCall(alSourcei(voice.source, AL_BUFFER, 0));
+                }
+                voice.buffer = {};
+            },
+            [this](Advance &c) {
+                if (m_mixer != nullptr) m_mixer->advance(c.elapsed);
+            },
+            [this](AddStream &c) {
+                m_streams.push_back(c.stream);
+                if (m_mixer != nullptr) m_mixer->attach(&c.stream->mixed());
+            },
+            [this](RemoveStream &c) {
+                m_streams.erase(std::remove(m_streams.begin(), m_streams.end(), c.stream.get()), m_streams.end());
+                if (m_mixer != nullptr) m_mixer->detach(&c.stream->mixed());
+                c.stream->close();
+            },
+        },
+        command);
+}
+
+auto engine::AudioThread::tick() -> void
+{
+    for (auto i = 0ul; i != m_voices.size(); i++) {
+        const auto &voice = m_voices[i];
+        m_snapshot[i].store(pack(status(voice), voice.sequence), std::memory_order_release);
+    }
+
+    for (auto *stream : m_streams) stream->update(m_mixer != nullptr);
+}
+
+auto engine::AudioThread::status(const Voice &voice) const -> SoundStatus
+{
+    if (m_mixer != nullptr) return m_mixer->status(voice.source);
+
+    ALint state = AL_INITIAL;
+    alCall(alGetSourcei(voice.source, AL_SOURCE_STATE, &state));
+
+    switch (state) {
+    case AL_INITIAL: return SoundStatus::INITIAL;
+    case AL_PLAYING: return SoundStatus::PLAYING;
+    case AL_PAUSED: return SoundStatus::PAUSED;
+    case AL_STOPPED: return SoundStatus::STOPPED;
+    default: std::abort();
+    }
+}
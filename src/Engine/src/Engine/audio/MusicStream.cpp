@@ -0,0 +1,266 @@
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/audio/MusicStream.hpp"
+#include "Engine/audio/AudioFileBuffer.hpp"
+#include "Engine/audio/WavReader.hpp"
+#include "Engine/audio/AlErrorHandling.hpp"
+#include "Engine/resources/FileSystem.hpp"
+#include "Engine/Core.hpp"
+
+engine::MusicStream::MusicStream(const std::string &path)
+{
+    for (auto &chunk : m_chunks) chunk.reserve(CHUNK_BYTES);
+
+    m_thread = std::thread{[this, path] { produce(path); }};
+}
+
+engine::MusicStream::~MusicStream() { close(); }
+
+auto engine::MusicStream::produce(const std::string &path) -> void
+{
+    // note : the file is mapped, only the pages of the chunks being copied are read from the disk
+    const auto file = Core::Holder{}.instance->getFileSystem().read(path);
+    const auto wav = file.has_value() ? load_wav(file->view()) : std::nullopt;
+
+    // note : a music that can't be opened has no sample, it is over as soon as it is played
+    std::string_view samples;
+    std::size_t chunk_bytes = CHUNK_BYTES;
+    try {
+        if (!wav.has_value()) throw std::runtime_error(fmt::format("Could not open the music '{}'", path));
+        m_format = AudioFileBuffer::format(wav->channels, wav->bits_per_sample);
+        m_sample_rate = wav->sample_rate;
+        samples = wav->samples;
+
+        // note : a chunk never splits a sample frame
+        const auto frame = std::max<std::size_t>(wav->channels * wav->bits_per_sample / 8, 1);
+        chunk_bytes = CHUNK_BYTES / frame * frame;
+    } catch (const std::exception &e) {
+        spdlog::error("Engine::MusicStream {}", e.what());
+    }
+
+    std::size_t offset = 0;
+    while (true) {
+        std::size_t slot = 0;
+        {
+            std::unique_lock lock{m_mutex};
+            m_cv.wait(lock, [this] { return m_stop || m_rewind || (!m_finished && m_write - m_read < BUFFERS); });
+            if (m_stop) return;
+
+            // note : the chunk copied while the stream was stopped is dropped, the next one is the first of the file
+            if (m_rewind) {
+                m_rewind = false;
+                m_finished = false;
+                m_write = m_read;
+                offset = 0;
+            }
+            slot = m_write % BUFFERS;
+        }
+
+        if (offset == samples.size()) {
+            if (!m_loop || samples.empty()) {
+                std::lock_guard lock{m_mutex};
+                m_finished = true;
+                continue;
+            }
+            offset = 0;
+        }
+
+        // note : the slot is not read by the audio thread until it is published
+        const auto size = std::min(chunk_bytes, samples.size() - offset);
+        m_chunks[slot].assign(samples.data() + offset, samples.data() + offset + size);
+        offset += size;
+
+        std::lock_guard lock{m_mutex};
+        m_write++;
+    }
+}
+
+auto engine::MusicStream::play() -> MusicStream &
+{
+    m_playing = m_thread.joinable();
+    return *this;
+}
+
+auto engine::MusicStream::stop() -> MusicStream &
+{
+    m_playing = false;
+    return *this;
+}
+
+// Range [0, +inf]
+auto engine::MusicStream::setVolume(float volume) -> MusicStream &
+{
+    m_volume = std::clamp(volume, 0.f, 99999.f);
+    return *this;
+}
+
+auto engine::MusicStream::setLoop(bool loop) -> MusicStream &
+{
+    m_loop = loop;
+    return *this;
+}
+
+auto engine::MusicStream::update(bool software) -> void
+{
+    if (!m_thread.joinable()) return;
+    if (software) return feed();
+
+    if (m_source == 0) {
+        alCall(alGenSources(1, &m_source));
+        alCall(alGenBuffers(static_cast<ALsizei>(BUFFERS), m_buffers.data()));
+        alCall(alSourcei(m_source, AL_SOURCE_RELATIVE, AL_TRUE));
+        m_idle.assign(m_buffers.begin(), m_buffers.end());
+    }
+
+    if (const float volume = m_volume; volume != m_gain) {
+        m_gain = volume;
+        alCall(alSourcef(m_source, AL_GAIN, m_gain));
+    }
+
+    // note : nothing is streamed while stopped, the next play starts from the beginning like a @Sound
+    if (!m_playing) {
+        if (m_started) rewind();
+        return;
+    }
+    m_started = true;
+
+    ALint processed = 0;
+    alCall(alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processed));
+    for (; processed > 0; processed--) {
+        ALuint buffer = 0;
+        alCall(alSourceUnqueueBuffers(m_source, 1, &buffer));
+        m_idle.push_back(buffer);
+    }
+
+    std::size_t ready = 0;
+    bool finished = false;
+    {
+        std::lock_guard lock{m_mutex};
+        // note : until the thread has rewound, the chunks it publishes are the ones of before the stop
+        ready = m_rewind ? 0 : std::min(m_write - m_read, m_idle.size());
+        finished = !m_rewind && m_finished && m_write == m_read;
+    }
+
+    for (auto i = 0ul; i != ready; i++) {
+        const auto &chunk = m_chunks[(m_read + i) % BUFFERS];
+        const auto buffer = m_idle.back();
+        m_idle.pop_back();
+
+        alCall(alBufferData(buffer, m_format, chunk.data(), static_cast<ALsizei>(chunk.size()), m_sample_rate));
+        alCall(alSourceQueueBuffers(m_source, 1, &buffer));
+    }
+
+    if (ready != 0) {
+        {
+            std::lock_guard lock{m_mutex};
+            m_read += ready;
+        }
+        m_cv.notify_one();
+    }
+
+    ALint state = AL_INITIAL;
+    alCall(alGetSourcei(m_source, AL_SOURCE_STATE, &state));
+    if (state == AL_PLAYING) return;
+
+    // note : the source stops by itself when it runs out of buffers, either the thread was late or the music is over
+    if (m_idle.size() != BUFFERS) {
+        alCall(alSourcePlay(m_source));
+    } else if (finished) {
+        m_playing = false;
+    }
+}
+
+auto engine::MusicStream::feed() -> void
+{
+    m_mixed.gain = m_volume;
+
+    if (!m_playing) {
+        if (m_started) rewind();
+        return;
+    }
+    m_started = true;
+
+    std::size_t ready = 0;
+    bool finished = false;
+    {
+        std::lock_guard lock{m_mutex};
+        ready = m_rewind ? 0 : std::min(m_write - m_read, BUFFERS - m_mixed.queued.size());
+        finished = !m_rewind && m_finished && m_write == m_read;
+    }
+
+    for (auto i = 0ul; i != ready; i++) {
+        const auto &chunk = m_chunks[(m_read + i) % BUFFERS];
+
+        // note : a played clip is taken back like a processed buffer, there are never more than BUFFERS clips
+        auto clip = SoftwareMixer::Clip{};
+        if (!m_mixed.played.empty()) {
+            clip = std::move(m_mixed.played.back());
+            m_mixed.played.pop_back();
+        }
+        AudioFileBuffer::convert(m_format, {chunk.data(), chunk.size()}, m_sample_rate, clip);
+        m_mixed.queued.push_back(std::move(clip));
+    }
+
+    if (ready != 0) {
+        {
+            std::lock_guard lock{m_mutex};
+            m_read += ready;
+        }
+        m_cv.notify_one();
+    }
+
+    // note : like the source, the stream stops by itself when the mixer runs out of clips
+    if (!m_mixed.queued.empty()) {
+        m_mixed.playing = true;
+    } else if (finished) {
+        m_playing = false;
+    }
+}
+
+auto engine::MusicStream::rewind() -> void
+{
+    m_started = false;
+
+    // note : every buffer of a stopped source is processed, they are all taken back at once
+    if (m_source != 0) {
+        alCall(alSourceStop(m_source));
+        alCall(alSourcei(m_source, AL_BUFFER, 0));
+        m_idle.assign(m_buffers.begin(), m_buffers.end());
+    }
+
+    // note : the same for the clips queued on the mixer
+    m_mixed.playing = false;
+    m_mixed.position = 0.0;
+    for (auto &clip : m_mixed.queued) m_mixed.played.push_back(std::move(clip));
+    m_mixed.queued.clear();
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_read = m_write;
+        m_rewind = true;
+    }
+    m_cv.notify_one();
+}
+
+auto engine::MusicStream::close() -> void
+{
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard lock{m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    if (m_source == 0) return;
+
+    m_playing = false;
+    alSourceStop(m_source);
+    alSourcei(m_source, AL_BUFFER, 0);
+    alDeleteSources(1, &m_source);
+    alDeleteBuffers(static_cast<ALsizei>(BUFFERS), m_buffers.data());
+    m_source = 0;
+}
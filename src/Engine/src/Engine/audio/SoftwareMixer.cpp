@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#    include <emmintrin.h>
+#    define ENGINE_MIXER_SSE2
+#endif
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/audio/SoftwareMixer.hpp"
+
+namespace {
+
+constexpr std::size_t kChannels = 2;
+
+// note : bus += in * gain
+auto accumulate(float *bus, const float *in, float gain, std::size_t count) -> void
+{
+    std::size_t i = 0;
+#ifdef ENGINE_MIXER_SSE2
+    const auto g = _mm_set1_ps(gain);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(bus + i, _mm_add_ps(_mm_loadu_ps(bus + i), _mm_mul_ps(_mm_loadu_ps(in + i), g)));
+    }
+#endif
+    for (; i != count; i++) bus[i] += in[i] * gain;
+}
+
+// note : saturated to the range of the output
+auto convert(std::int16_t *out, const float *in, std::size_t count) -> void
+{
+    std::size_t i = 0;
+#ifdef ENGINE_MIXER_SSE2
+    const auto scale = _mm_set1_ps(32767.0f);
+    const auto low = _mm_set1_ps(-1.0f);
+    const auto high = _mm_set1_ps(1.0f);
+    for (; i + 8 <= count; i += 8) {
+        const auto a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i), low), high), scale);
+        const auto b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i + 4), low), high), scale);
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(out + i), _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+#endif
+    for (; i != count; i++) out[i] = static_cast<std::int16_t>(std::lrint(std::clamp(in[i], -1.0f, 1.0f) * 32767.0f));
+}
+
+// note : the canonical 44 bytes header of a 16 bits PCM wav file, little endian
+struct WavHeader {
+    char riff[4];
+    std::uint32_t riff_size;
+    char wave[4];
+    char fmt[4];
+    std::uint32_t fmt_size;
+    std::uint16_t encoding;
+    std::uint16_t channels;
+    std::uint32_t sample_rate;
+    std::uint32_t byte_rate;
+    std::uint16_t block_align;
+    std::uint16_t bits_per_sample;
+    char data[4];
+    std::uint32_t data_size;
+};
+
+auto header(std::uint64_t bytes) -> WavHeader
+{
+    const auto size = static_cast<std::uint32_t>(std::min<std::uint64_t>(bytes, 0xFFFFFFFFull - 36));
+    return WavHeader{
+        .riff = {'R', 'I', 'F', 'F'},
+        .riff_size = 36 + size,
+        .wave = {'W', 'A', 'V', 'E'},
+        .fmt = {'f', 'm', 't', ' '},
+        .fmt_size = 16,
+        .encoding = 1,
+        .channels = kChannels,
+        .sample_rate = engine::SoftwareMixer::SAMPLE_RATE,
+        .byte_rate = engine::SoftwareMixer::SAMPLE_RATE * kChannels * sizeof(std::int16_t),
+        .block_align = kChannels * sizeof(std::int16_t),
+        .bits_per_sample = 16,
+        .data = {'d', 'a', 't', 'a'},
+        .data_size = size,
+    };
+}
+
+} // namespace
+
+engine::SoftwareMixer::SoftwareMixer(std::size_t voices, const std::string &wav) :
+    m_voices(voices), m_bus(BLOCK * kChannels), m_scratch(BLOCK * kChannels), m_output(BLOCK * kChannels)
+{
+    if (wav.empty()) {
+        spdlog::info("Engine::SoftwareMixer mixing {} voices to the null sink", voices);
+        return;
+    }
+
+    std::error_code ec;
+    if (const auto folder = std::filesystem::path{wav}.parent_path(); !folder.empty())
+        std::filesystem::create_directories(folder, ec);
+
+    m_wav.open(wav, std::ios::binary | std::ios::trunc);
+    if (!m_wav.is_open()) {
+        spdlog::warn("Engine::SoftwareMixer could not open '{}', mixing to the null sink", wav);
+        return;
+    }
+
+    const auto placeholder = header(0);
+    m_wav.write(reinterpret_cast<const char *>(&placeholder), sizeof(placeholder));
+    spdlog::info("Engine::SoftwareMixer mixing {} voices to '{}'", voices, wav);
+}
+
+engine::SoftwareMixer::~SoftwareMixer()
+{
+    if (m_stats.frames != 0) {
+        spdlog::info(
+            "Engine::SoftwareMixer mixed {:.1f} s of audio and {:.1f} s of voices in {:.1f} ms",
+            static_cast<double>(m_stats.frames) / SAMPLE_RATE,
+            static_cast<double>(m_stats.voice_frames) / SAMPLE_RATE,
+            std::chrono::duration<double, std::milli>(m_stats.time).count());
+    }
+
+    if (!m_wav.is_open()) return;
+
+    // note : the sizes are only known now
+    const auto final = header(m_written);
+    m_wav.seekp(0);
+    m_wav.write(reinterpret_cast<const char *>(&final), sizeof(final));
+}
+
+auto engine::SoftwareMixer::assign(std::size_t voice, const Clip *clip) -> void
+{
+    m_voices[voice] = Voice{.clip = clip};
+}
+
+auto engine::SoftwareMixer::play(std::size_t voice) -> void
+{
+    auto &v = m_voices[voice];
+    if (v.clip == nullptr) return;
+
+    // note : like OpenAL, a sound played again starts over
+    if (v.status != SoundStatus::PAUSED) v.position = 0.0;
+    v.status = SoundStatus::PLAYING;
+}
+
+auto engine::SoftwareMixer::stop(std::size_t voice) -> void { m_voices[voice].status = SoundStatus::STOPPED; }
+
+auto engine::SoftwareMixer::attach(Stream *stream) -> void { m_streams.push_back(stream); }
+
+auto engine::SoftwareMixer::detach(Stream *stream) -> void
+{
+    m_streams.erase(std::remove(m_streams.begin(), m_streams.end(), stream), m_streams.end());
+}
+
+auto engine::SoftwareMixer::advance(std::chrono::nanoseconds elapsed) -> void
+{
+    m_pending += elapsed;
+    const auto frames = static_cast<std::size_t>(m_pending.count() * SAMPLE_RATE / 1'000'000'000);
+    m_pending -= std::chrono::nanoseconds{static_cast<std::int64_t>(frames) * 1'000'000'000 / SAMPLE_RATE};
+
+    mix(frames);
+}
+
+auto engine::SoftwareMixer::mix(std::size_t frames) -> void
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (auto done = 0ul; done != frames;) {
+        const auto count = std::min(BLOCK, frames - done);
+        std::fill_n(m_bus.begin(), count * kChannels, 0.0f);
+
+        for (auto &voice : m_voices) {
+            if (voice.status != SoundStatus::PLAYING) continue;
+
+            const auto rendered = render(voice, m_scratch.data(), count);
+            accumulate(m_bus.data(), m_scratch.data(), voice.gain, rendered * kChannels);
+            m_stats.voice_frames += rendered;
+        }
+
+        for (auto *stream : m_streams) {
+            if (!stream->playing) continue;
+
+            const auto rendered = render(*stream, m_scratch.data(), count);
+            accumulate(m_bus.data(), m_scratch.data(), stream->gain, rendered * kChannels);
+            m_stats.voice_frames += rendered;
+        }
+
+        convert(m_output.data(), m_bus.data(), count * kChannels);
+        write(m_output.data(), count * kChannels);
+
+        done += count;
+    }
+
+    m_stats.frames += frames;
+    m_stats.time += std::chrono::steady_clock::now() - start;
+}
+
+auto engine::SoftwareMixer::render(Voice &voice, float *out, std::size_t frames) -> std::size_t
+{
+    const auto &clip = *voice.clip;
+    const auto length = clip.frames();
+    const auto step = static_cast<double>(voice.pitch) * clip.sample_rate / SAMPLE_RATE;
+    const auto *samples = clip.samples.data();
+
+    for (auto i = 0ul; i != frames; i++) {
+        if (voice.position >= static_cast<double>(length)) {
+            if (!voice.loop || length == 0) {
+                voice.status = SoundStatus::STOPPED;
+                return i;
+            }
+            voice.position = std::fmod(voice.position, static_cast<double>(length));
+        }
+
+        // note : linear interpolation between the two closest frames of the clip
+        const auto index = static_cast<std::size_t>(voice.position);
+        const auto next = index + 1 < length ? index + 1 : (voice.loop ? 0 : index);
+        const auto t = static_cast<float>(voice.position - static_cast<double>(index));
+
+        if (clip.channels == 1) {
+            const auto value = samples[index] + (samples[next] - samples[index]) * t;
+            out[i * 2] = value;
+            out[i * 2 + 1] = value;
+        } else {
+            const auto *a = samples + index * clip.channels;
+            const auto *b = samples + next * clip.channels;
+            out[i * 2] = a[0] + (b[0] - a[0]) * t;
+            out[i * 2 + 1] = a[1] + (b[1] - a[1]) * t;
+        }
+
+        voice.position += step;
+    }
+    return frames;
+}
+
+auto engine::SoftwareMixer::render(Stream &stream, float *out, std::size_t frames) -> std::size_t
+{
+    auto done = 0ul;
+    while (done != frames && !stream.queued.empty()) {
+        auto &clip = stream.queued.front();
+        auto voice = Voice{.clip = &clip, .position = stream.position, .status = SoundStatus::PLAYING};
+
+        done += render(voice, out + done * kChannels, frames - done);
+        stream.position = voice.position;
+        if (voice.status == SoundStatus::PLAYING) continue;
+
+        // note : the part of a frame left over is carried to the next clip
+        stream.position = std::max(0.0, stream.position - static_cast<double>(clip.frames()));
+        stream.played.push_back(std::move(clip));
+        stream.queued.pop_front();
+    }
+
+    if (stream.queued.empty()) stream.playing = false;
+    return done;
+}
+
+auto engine::SoftwareMixer::write(const std::int16_t *samples, std::size_t count) -> void
+{
+    if (!m_wav.is_open()) return;
+
+    const auto bytes = count * sizeof(std::int16_t);
+    m_wav.write(reinterpret_cast<const char *>(samples), static_cast<std::streamsize>(bytes));
+    m_written += bytes;
+}
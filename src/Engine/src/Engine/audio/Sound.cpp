@@ -1,36 +1,19 @@
 #include "Engine/audio/Sound.hpp"
-#include "Engine/audio/AlErrorHandling.hpp"
 
-#include <spdlog/spdlog.h>
+#include <algorithm>
 
-engine::Sound::Sound(ALuint soundBuffer)
-{
-    alCall(alGenSources(1, &m_buffer));
-
-    alCall(alSourcef(m_buffer, AL_PITCH, 1));
-    alCall(alSourcef(m_buffer, AL_GAIN, 1.0f));
-    alCall(alSource3f(m_buffer, AL_POSITION, 0, 0, 0));
-    alCall(alSource3f(m_buffer, AL_VELOCITY, 0, 0, 0));
-    alCall(alSourcei(m_buffer, AL_LOOPING, AL_FALSE));
-    alCall(alSourcei(m_buffer, AL_BUFFER, static_cast<ALint>(soundBuffer)));
-}
-
-engine::Sound::Sound() : m_alive(false) {}
-
-engine::Sound::~Sound() { forceDestroy(); }
-
-std::shared_ptr<engine::Sound> engine::Sound::GetEmptySound() { return std::shared_ptr<Sound>(new Sound); }
+engine::Sound::Sound(VoicePool &pool, VoicePool::Handle handle) : m_pool{&pool}, m_handle{handle} {}
 
 auto engine::Sound::play() -> Sound &
 {
-    if (m_alive) alCall(alSourcePlay(m_buffer));
+    if (m_pool != nullptr) m_pool->play(m_handle);
 
     return *this;
 }
 
 auto engine::Sound::stop() -> Sound &
 {
-    if (m_alive) alCall(alSourceStop(m_buffer));
+    if (m_pool != nullptr) m_pool->stop(m_handle);
 
     return *this;
 }
@@ -38,79 +21,44 @@ auto engine::Sound::stop() -> Sound &
 // Range [0.5; 2]
 auto engine::Sound::setSpeed(float speed) -> Sound &
 {
-    if (m_alive) {
-        speed = std::clamp(speed, 0.5f, 2.f);
-        alCall(alSourcef(m_buffer, AL_PITCH, speed));
-    }
+    if (m_pool != nullptr) m_pool->setPitch(m_handle, std::clamp(speed, 0.5f, 2.f));
 
     return *this;
 }
 // Range [0, +inf]
 auto engine::Sound::setVolume(float volume) -> Sound &
 {
-    if (m_alive) {
-        volume = std::clamp(volume, 0.f, 99999.f);
-        alCall(alSourcef(m_buffer, AL_GAIN, volume));
-    }
+    if (m_pool != nullptr) m_pool->setGain(m_handle, std::clamp(volume, 0.f, 99999.f));
 
     return *this;
 }
 
 auto engine::Sound::setLoop(bool loop) -> Sound &
 {
-    if (m_alive) alCall(alSourcei(m_buffer, AL_LOOPING, loop ? AL_TRUE : AL_FALSE));
+    if (m_pool != nullptr) m_pool->setLoop(m_handle, loop);
     return *this;
 }
 
 auto engine::Sound::getStatus() const -> SoundStatus
 {
-    if (!m_alive) return SoundStatus::STOPPED;
-
-    ALint state;
-    alCall(alGetSourcei(m_buffer, AL_SOURCE_STATE, &state));
-
-    switch (state) {
-    case AL_INITIAL: return SoundStatus::INITIAL;
-    case AL_PLAYING: return SoundStatus::PLAYING;
-    case AL_PAUSED: return SoundStatus::PAUSED;
-    case AL_STOPPED: return SoundStatus::STOPPED;
-    default: std::abort();
-    }
+    if (m_pool == nullptr) return SoundStatus::STOPPED;
+    return m_pool->status(m_handle);
 }
 
-
 auto engine::Sound::getSpeed() const -> float
 {
-    if (!m_alive) return 0;
-
-    float result;
-    alCall(alGetSourcef(m_buffer, AL_PITCH, &result));
-    return result;
+    if (m_pool == nullptr) return 0;
+    return m_pool->pitch(m_handle);
 }
 
 auto engine::Sound::getVolume() const -> float
 {
-    if (!m_alive) return 0;
-
-    float result;
-    alCall(alGetSourcef(m_buffer, AL_GAIN, &result));
-    return result;
+    if (m_pool == nullptr) return 0;
+    return m_pool->gain(m_handle);
 }
-auto engine::Sound::doesLoop() const -> bool
-{
-    if (!m_alive) return false;
 
-    ALint result;
-    alCall(alGetSourcei(m_buffer, AL_LOOPING, &result));
-    return result;
-}
-
-auto engine::Sound::forceDestroy() -> void
+auto engine::Sound::doesLoop() const -> bool
 {
-    if (!m_alive) return;
-
-    m_alive = false;
-
-    alSourceStop(m_buffer);
-    alDeleteSources(1, &m_buffer);
+    if (m_pool == nullptr) return false;
+    return m_pool->loop(m_handle);
 }
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cmath>
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include "Engine/audio/SoundEvents.hpp"
+#include "Engine/audio/AudioManager.hpp"
+#include "Engine/resources/FileSystem.hpp"
+#include "Engine/Core.hpp"
+
+namespace {
+
+auto parse(const nlohmann::json &j, const engine::SoundEvents::Rule &fallback) -> engine::SoundEvents::Rule
+{
+    return engine::SoundEvents::Rule{
+        .cooldown = std::chrono::milliseconds{j.value("cooldown", fallback.cooldown.count())},
+        .instances = j.value("instances", fallback.instances),
+        .max_gain = j.value("max_gain", fallback.max_gain),
+    };
+}
+
+} // namespace
+
+auto engine::SoundEvents::fromFile(const std::string_view path) -> bool
+{
+    const auto file = Core::Holder{}.instance->getFileSystem().read(path);
+    if (!file.has_value()) {
+        spdlog::error("Engine::SoundEvents can't open '{}'", path);
+        return false;
+    }
+    const auto jsonData = nlohmann::json::parse(file->view());
+
+    // note : the default rule first, the fields missing from a rule are the ones of the default rule
+    if (const auto found = jsonData.find("default"); found != jsonData.end()) m_default = parse(*found, m_default);
+
+    for (const auto &[name, data] : jsonData.items()) {
+        if (name != "default") setRule(ResourceId::intern(name), parse(data, m_default));
+    }
+
+    return true;
+}
+
+auto engine::SoundEvents::setRule(const ResourceId &sound, const Rule &rule) -> void { m_rules[sound.id()] = rule; }
+
+auto engine::SoundEvents::post(const ResourceId &sound, SoundPriority priority, float volume) -> void
+{
+    m_stats.requested++;
+
+    auto &entry = m_entries[sound.id()];
+    if (entry.requests == 0) {
+        entry.sound = sound;
+        entry.priority = priority;
+        entry.volume = volume;
+        m_pending.push_back(sound.id());
+    } else {
+        entry.priority = std::max(entry.priority, priority);
+        entry.volume = std::max(entry.volume, volume);
+    }
+    entry.requests++;
+}
+
+auto engine::SoundEvents::flush(AudioManager &audio, std::chrono::nanoseconds elapsed) -> void
+{
+    m_time += elapsed;
+
+    for (const auto id : m_pending) {
+        auto &entry = m_entries[id];
+        const auto &rule = this->rule(id);
+        const auto requests = std::exchange(entry.requests, 0u);
+
+        entry.playing.erase(
+            std::remove_if(
+                entry.playing.begin(),
+                entry.playing.end(),
+                [](const auto &sound) { return sound.getStatus() == SoundStatus::STOPPED; }),
+            entry.playing.end());
+
+        const auto cooling = entry.started.has_value() && m_time - entry.started.value() < rule.cooldown;
+        const auto crowded = rule.instances != 0 && entry.playing.size() >= rule.instances;
+        if (cooling || crowded) {
+            m_stats.throttled += requests;
+            continue;
+        }
+
+        // note : the requests are not correlated, their energies add up
+        const auto gain = std::min(std::sqrt(static_cast<float>(requests)), std::max(rule.max_gain, 1.0f));
+
+        auto sound = audio.getSound(entry.sound, entry.priority);
+        sound.setVolume(entry.volume * gain).play();
+
+        entry.started = m_time;
+        if (rule.instances != 0) entry.playing.push_back(sound);
+
+        m_stats.played++;
+        m_stats.merged += requests - 1;
+    }
+    m_pending.clear();
+}
+
+auto engine::SoundEvents::rule(entt::id_type id) const -> const Rule &
+{
+    const auto found = m_rules.find(id);
+    return found != m_rules.end() ? found->second : m_default;
+}
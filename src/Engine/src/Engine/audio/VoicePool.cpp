@@ -0,0 +1,196 @@
+#include <spdlog/spdlog.h>
+
+#include "Engine/audio/VoicePool.hpp"
+#include "Engine/audio/AudioThread.hpp"
+#include "Engine/audio/AudioFileBuffer.hpp"
+
+engine::VoicePool::VoicePool(AudioThread &audio) : m_audio{audio}
+{
+    m_voices.resize(m_audio.size());
+    m_free.reserve(m_voices.size());
+    for (auto i = m_voices.size(); i != 0; i--) m_free.push_back(static_cast<Index>(i - 1));
+
+    spdlog::info("Engine::VoicePool {} voices", m_voices.size());
+}
+
+auto engine::VoicePool::acquire(entt::resource_handle<AudioFileBuffer> buffer, SoundPriority priority)
+    -> std::optional<Handle>
+{
+    auto index = npos;
+    if (!m_free.empty()) {
+        index = m_free.back();
+        m_free.pop_back();
+    } else {
+        for (auto i = 0ul; i <= static_cast<std::size_t>(priority) && index == npos; i++) index = m_busy[i].head;
+        if (index == npos) return {};
+
+        // note : the assignment stops the sound being played
+        unlink(index);
+        m_stolen++;
+    }
+
+    auto &voice = m_voices[index];
+    voice.generation++;
+    voice.priority = priority;
+    voice.busy = true;
+    voice.frame = m_frame;
+    voice.expected = SoundStatus::INITIAL;
+    voice.pitch = 1.0f;
+    voice.gain = 1.0f;
+    voice.loop = false;
+    link(index);
+
+    m_audio.post(AudioThread::Assign{{index, ++voice.sequence}, std::move(buffer)});
+
+    return Handle{.index = index, .generation = voice.generation};
+}
+
+auto engine::VoicePool::play(const Handle &handle) -> void
+{
+    auto *voice = find(handle);
+    if (voice == nullptr) return;
+
+    voice->expected = SoundStatus::PLAYING;
+    m_audio.post(AudioThread::Play{{handle.index, ++voice->sequence}});
+}
+
+auto engine::VoicePool::stop(const Handle &handle) -> void
+{
+    auto *voice = find(handle);
+    if (voice == nullptr) return;
+
+    voice->expected = SoundStatus::STOPPED;
+    m_audio.post(AudioThread::Stop{{handle.index, ++voice->sequence}});
+}
+
+auto engine::VoicePool::setPitch(const Handle &handle, float pitch) -> void
+{
+    auto *voice = find(handle);
+    if (voice == nullptr) return;
+
+    voice->pitch = pitch;
+    m_audio.post(AudioThread::SetPitch{{handle.index, ++voice->sequence}, pitch});
+}
+
+auto engine::VoicePool::setGain(const Handle &handle, float gain) -> void
+{
+    auto *voice = find(handle);
+    if (voice == nullptr) return;
+
+    voice->gain = gain;
+    m_audio.post(AudioThread::SetGain{{handle.index, ++voice->sequence}, gain});
+}
+
+auto engine::VoicePool::setLoop(const Handle &handle, bool loop) -> void
+{
+    auto *voice = find(handle);
+    if (voice == nullptr) return;
+
+    voice->loop = loop;
+    m_audio.post(AudioThread::SetLoop{{handle.index, ++voice->sequence}, loop});
+}
+
+auto engine::VoicePool::status(const Handle &handle) const -> SoundStatus
+{
+    if (find(handle) == nullptr) return SoundStatus::STOPPED;
+    return status(handle.index);
+}
+
+auto engine::VoicePool::pitch(const Handle &handle) const -> float
+{
+    const auto *voice = find(handle);
+    return voice != nullptr ? voice->pitch : 0.0f;
+}
+
+auto engine::VoicePool::gain(const Handle &handle) const -> float
+{
+    const auto *voice = find(handle);
+    return voice != nullptr ? voice->gain : 0.0f;
+}
+
+auto engine::VoicePool::loop(const Handle &handle) const -> bool
+{
+    const auto *voice = find(handle);
+    return voice != nullptr && voice->loop;
+}
+
+auto engine::VoicePool::update() -> void
+{
+    m_frame++;
+
+    for (auto i = 0ul; i != m_voices.size(); i++) {
+        const auto &voice = m_voices[i];
+        if (!voice.busy) continue;
+
+        const auto status = this->status(static_cast<Index>(i));
+
+        // note : a sound not played by the frame which acquired it will never be
+        if (status == SoundStatus::STOPPED || (status == SoundStatus::INITIAL && voice.frame + 1 < m_frame))
+            release(static_cast<Index>(i));
+    }
+}
+
+auto engine::VoicePool::find(const Handle &handle) noexcept -> Voice *
+{
+    if (handle.index >= m_voices.size()) return nullptr;
+
+    auto &voice = m_voices[handle.index];
+    if (!voice.busy || voice.generation != handle.generation) return nullptr;
+    return &voice;
+}
+
+auto engine::VoicePool::find(const Handle &handle) const noexcept -> const Voice *
+{
+    return const_cast<VoicePool *>(this)->find(handle);
+}
+
+auto engine::VoicePool::status(Index index) const -> SoundStatus
+{
+    // note : the snapshot is older than the last command posted, the command is assumed to succeed
+    const auto state = m_audio.snapshot(index);
+    return state.sequence == m_voices[index].sequence ? state.status : m_voices[index].expected;
+}
+
+auto engine::VoicePool::link(Index index) -> void
+{
+    auto &voice = m_voices[index];
+    auto &list = m_busy[static_cast<std::size_t>(voice.priority)];
+
+    voice.prev = list.tail;
+    voice.next = npos;
+    if (list.tail != npos) {
+        m_voices[list.tail].next = index;
+    } else {
+        list.head = index;
+    }
+    list.tail = index;
+}
+
+auto engine::VoicePool::unlink(Index index) -> void
+{
+    auto &voice = m_voices[index];
+    auto &list = m_busy[static_cast<std::size_t>(voice.priority)];
+
+    if (voice.prev != npos) {
+        m_voices[voice.prev].next = voice.next;
+    } else {
+        list.head = voice.next;
+    }
+    if (voice.next != npos) {
+        m_voices[voice.next].prev = voice.prev;
+    } else {
+        list.tail = voice.prev;
+    }
+    voice.prev = npos;
+    voice.next = npos;
+}
+
+auto engine::VoicePool::release(Index index) -> void
+{
+    auto &voice = m_voices[index];
+    unlink(index);
+    voice.busy = false;
+    voice.generation++;
+    m_audio.post(AudioThread::Release{{index, ++voice.sequence}});
+    m_free.push_back(index);
+}
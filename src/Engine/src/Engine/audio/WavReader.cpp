@@ -1,94 +1,107 @@
 #include "Engine/audio/WavReader.hpp"
+#include <algorithm>
 #include <bit>
-#include <fstream>
+#include <cstring>
 #include <spdlog/spdlog.h>
 
-static std::int32_t convert_to_int(char *buffer, std::size_t len)
-{
-    std::int32_t a = 0;
-    if constexpr (std::endian::native == std::endian::little)
-        std::memcpy(&a, buffer, len);
-    else
-        for (std::size_t i = 0; i < len; ++i) { reinterpret_cast<char *>(&a)[3 - i] = buffer[i]; }
-    return a;
-}
-
-bool load_wav_file_header(
-    std::ifstream &file, std::uint8_t &channels, std::int32_t &sampleRate, std::uint8_t &bitsPerSample, ALsizei &size)
-{
-    char buffer[4];
-    if (!file.is_open()) return false;
-
-    // the RIFF
-    if (!file.read(buffer, 4)) { return false; }
-    if (std::strncmp(buffer, "RIFF", 4) != 0) { return false; }
-
-    // the size of the file
-    if (!file.read(buffer, 4)) { return false; }
-
-    // the WAVE
-    if (!file.read(buffer, 4)) { return false; }
-    if (std::strncmp(buffer, "WAVE", 4) != 0) { return false; }
-
-    // "fmt/0"
-    if (!file.read(buffer, 4)) { return false; }
-
-    // this is always 16, the size of the fmt data chunk
-    if (!file.read(buffer, 4)) { return false; }
-
-    // PCM should be 1?
-    if (!file.read(buffer, 2)) { return false; }
-
-    // the number of channels
-    if (!file.read(buffer, 2)) { return false; }
-    channels = static_cast<uint8_t>(convert_to_int(buffer, 2));
+namespace {
 
-    // sample rate
-    if (!file.read(buffer, 4)) { return false; }
-    sampleRate = convert_to_int(buffer, 4);
+constexpr std::uint16_t kFormatPcm = 0x0001;
+constexpr std::uint16_t kFormatExtensible = 0xFFFE;
 
-    // (sampleRate * bitsPerSample * channels) / 8
-    if (!file.read(buffer, 4)) { return false; }
-
-    // ?? dafaq
-    if (!file.read(buffer, 2)) { return false; }
+// note : the fields of a RIFF file are little endian
+template<typename T>
+auto read_le(const char *buffer) -> T
+{
+    T out{};
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(&out, buffer, sizeof(T));
+    } else {
+        for (auto i = 0ul; i != sizeof(T); i++) reinterpret_cast<char *>(&out)[sizeof(T) - 1 - i] = buffer[i];
+    }
+    return out;
+}
 
-    // bitsPerSample
-    if (!file.read(buffer, 2)) { return false; }
-    bitsPerSample = static_cast<uint8_t>(convert_to_int(buffer, 2));
+struct Chunk {
+    std::string_view id;
+    std::string_view payload;
+};
 
-    // data chunk header "data"
-    if (!file.read(buffer, 4)) { return false; }
-    if (std::strncmp(buffer, "data", 4) != 0) { return false; }
+// note : nullopt at the end of the file, a truncated payload is cut to the bytes available
+auto next_chunk(std::string_view &file) -> std::optional<Chunk>
+{
+    if (file.size() < 8) return {};
 
-    // size of data
-    if (!file.read(buffer, 4)) { return false; }
-    size = convert_to_int(buffer, 4);
+    const auto id = file.substr(0, 4);
+    const auto size = static_cast<std::size_t>(read_le<std::uint32_t>(file.data() + 4));
+    file.remove_prefix(8);
 
-    /* cannot be at the end of file */
-    if (file.eof()) { return false; }
-    if (file.fail()) { return false; }
+    if (size > file.size()) {
+        spdlog::warn("wav chunk '{}' truncated: {} bytes announced, {} available", id, size, file.size());
+        const auto payload = file;
+        file = {};
+        return Chunk{.id = id, .payload = payload};
+    }
 
-    return true;
+    const auto payload = file.substr(0, size);
+    // note : a chunk of odd size is followed by a padding byte
+    file.remove_prefix(std::min(size + (size & 1), file.size()));
+    return Chunk{.id = id, .payload = payload};
 }
 
-auto engine::load_wav(
-    const std::string_view filename, std::uint8_t &channels, std::int32_t &sampleRate, std::uint8_t &bitsPerSample, ALsizei &size)
-    -> char *
+} // namespace
+
+auto engine::load_wav(const std::string_view content) -> std::optional<Wav>
 {
-    std::ifstream in(filename.data(), std::ios::binary);
-    if (!in.is_open()) {
-        spdlog::error("ERROR: Could not open '{}'", filename);
-        return nullptr;
-    }
-    if (!load_wav_file_header(in, channels, sampleRate, bitsPerSample, size)) {
-        spdlog::error("ERROR: Could not load wav header of '{}'", filename);
-        return nullptr;
+    if (content.size() < 12 || content.substr(0, 4) != "RIFF" || content.substr(8, 4) != "WAVE") {
+        spdlog::warn("wav: not a RIFF WAVE file");
+        return {};
     }
 
-    auto data = new char[static_cast<std::size_t>(size)];
-
-    in.read(data, size);
+    auto file = content.substr(12);
+    std::optional<Wav> out;
+    std::optional<std::string_view> samples;
+
+    while (const auto chunk = next_chunk(file)) {
+        if (chunk->id == "fmt ") {
+            if (chunk->payload.size() < 16) {
+                spdlog::warn("wav: 'fmt ' chunk of {} bytes", chunk->payload.size());
+                return {};
+            }
+
+            const auto *data = chunk->payload.data();
+            auto encoding = read_le<std::uint16_t>(data);
+            // note : the encoding of an extensible format is the start of its sub format guid
+            if (encoding == kFormatExtensible && chunk->payload.size() >= 26) {
+                encoding = read_le<std::uint16_t>(data + 24);
+            }
+            if (encoding != kFormatPcm) {
+                spdlog::warn("wav: encoding {:#06x} not supported, only the integer PCM is", encoding);
+                return {};
+            }
+
+            out = Wav{
+                .channels = static_cast<std::uint8_t>(read_le<std::uint16_t>(data + 2)),
+                .sample_rate = read_le<std::int32_t>(data + 4),
+                .bits_per_sample = static_cast<std::uint8_t>(read_le<std::uint16_t>(data + 14)),
+                .samples = {},
+            };
+        } else if (chunk->id == "data") {
+            samples = chunk->payload;
+        }
+
+        if (out.has_value() && samples.has_value()) {
+            const auto frame = static_cast<std::size_t>(out->channels) * ((out->bits_per_sample + 7u) / 8u);
+            if (frame == 0) {
+                spdlog::warn("wav: {} channels of {} bits per sample", out->channels, out->bits_per_sample);
+                return {};
+            }
+            // note : a truncated file ends with a partial frame, it is never read
+            out->samples = samples->substr(0, samples->size() / frame * frame);
+            return out;
+        }
+    }
 
-    return data;
+    spdlog::warn("wav: missing the '{}' chunk", out.has_value() ? "data" : "fmt ");
+    return {};
 }
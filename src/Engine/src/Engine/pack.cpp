@@ -0,0 +1,19 @@
+#include <CLI/CLI.hpp>
+#include <spdlog/spdlog.h>
+
+#include <Engine/resources/AssetPack.hpp>
+#include <Engine/Options.hpp>
+
+// note : build the asset pack read by engine_main, see @FileSystem
+int main(int argc, char **argv)
+{
+    std::string data_folder = engine::Options::DEFAULT_DATA_FOLDER;
+    std::string output = engine::Options::DEFAULT_PACK;
+
+    CLI::App app{"Pack the data folder in one archive", argv[0]};
+    app.add_option("--data", data_folder, "Path of the data folder.", true);
+    app.add_option("--output", output, "Path of the asset pack.", true);
+    CLI11_PARSE(app, argc, argv);
+
+    return engine::AssetPack::build(data_folder, output) ? 0 : 1;
+}
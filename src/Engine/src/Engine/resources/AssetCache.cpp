@@ -0,0 +1,293 @@
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/resources/AssetCache.hpp"
+#include "Engine/resources/FileSystem.hpp"
+#include "Engine/Core.hpp"
+
+namespace {
+
+struct TextureHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::int32_t width;
+    std::int32_t height;
+    std::uint32_t levels;
+    std::uint32_t reserved[3];
+};
+
+constexpr char kTextureMagic[4] = {'T', 'E', 'X', 'C'};
+constexpr char kSpritesheetMagic[4] = {'S', 'P', 'R', 'C'};
+constexpr char kProgramMagic[4] = {'P', 'R', 'G', 'C'};
+
+// note : native byte order, the cache is never shared across platforms
+struct Writer {
+    std::string out;
+
+    template<typename T>
+    auto put(const T &value) -> void
+    {
+        out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    auto put(const std::string_view value) -> void
+    {
+        put(static_cast<std::uint32_t>(value.size()));
+        out.append(value);
+    }
+};
+
+struct Reader {
+    std::string_view in;
+    bool ok{true};
+
+    template<typename T>
+    auto get() -> T
+    {
+        T value{};
+        if (in.size() < sizeof(T)) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, in.data(), sizeof(T));
+        in.remove_prefix(sizeof(T));
+        return value;
+    }
+
+    auto string() -> std::string
+    {
+        const auto size = get<std::uint32_t>();
+        if (in.size() < size) {
+            ok = false;
+            return {};
+        }
+        std::string value{in.substr(0, size)};
+        in.remove_prefix(size);
+        return value;
+    }
+};
+
+auto serialize(const engine::Spritesheet &sprite) -> std::string
+{
+    Writer writer;
+    writer.put(kSpritesheetMagic);
+    writer.put(engine::AssetCache::kVersion);
+    writer.put(static_cast<std::uint32_t>(sprite.animations.size()));
+    for (const auto &animation : sprite.animations) {
+        writer.put(std::string_view{animation.name});
+        writer.put(std::string_view{animation.file});
+        writer.put(engine::Spritesheet::imageSize(animation.file).value_or(std::array<std::int32_t, 2>{}));
+        writer.put(animation.width);
+        writer.put(animation.height);
+        writer.put(static_cast<std::int64_t>(animation.cooldown.count()));
+        writer.put(static_cast<std::uint32_t>(animation.frames.size()));
+        for (const auto &frame : animation.frames) {
+            writer.put(frame.x);
+            writer.put(frame.y);
+        }
+        writer.put(static_cast<std::uint32_t>(animation.uvs.size()));
+        for (const auto &uv : animation.uvs) writer.put(uv);
+    }
+    return std::move(writer.out);
+}
+
+auto deserialize(const std::string_view content) -> std::optional<engine::Spritesheet>
+{
+    Reader reader{.in = content};
+    const auto magic = reader.get<std::array<char, 4>>();
+    if (std::memcmp(magic.data(), kSpritesheetMagic, sizeof(kSpritesheetMagic)) != 0
+        || reader.get<std::uint32_t>() != engine::AssetCache::kVersion) {
+        return {};
+    }
+
+    engine::Spritesheet out;
+
+    const auto count = reader.get<std::uint32_t>();
+    for (auto i = 0u; reader.ok && i != count; i++) {
+        engine::Spritesheet::Animation animation;
+        animation.name = reader.string();
+        animation.file = reader.string();
+        animation.texture = engine::ResourceId::intern(animation.file);
+        // note : the clip rectangles are stale once the image is resized, even if the json is the same
+        if (reader.get<std::array<std::int32_t, 2>>()
+            != engine::Spritesheet::imageSize(animation.file).value_or(std::array<std::int32_t, 2>{})) {
+            return {};
+        }
+        animation.width = reader.get<std::uint16_t>();
+        animation.height = reader.get<std::uint16_t>();
+        animation.cooldown = std::chrono::milliseconds{reader.get<std::int64_t>()};
+
+        const auto frames = reader.get<std::uint32_t>();
+        for (auto j = 0u; reader.ok && j != frames; j++) {
+            const auto x = reader.get<std::uint16_t>();
+            const auto y = reader.get<std::uint16_t>();
+            animation.frames.push_back({x, y});
+        }
+        const auto uvs = reader.get<std::uint32_t>();
+        for (auto j = 0u; reader.ok && j != uvs; j++) animation.uvs.push_back(reader.get<std::array<float, 4ul>>());
+
+        out.animations.push_back(std::move(animation));
+    }
+
+    if (!reader.ok || !reader.in.empty()) return {};
+    return out;
+}
+
+} // namespace
+
+engine::AssetCache::AssetCache(Config &&config) : m_config{std::move(config)}
+{
+    if (!m_config.enabled) return;
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_config.folder, ec);
+    if (ec) {
+        spdlog::warn("Engine::AssetCache could not create '{}': {}, the cache is disabled", m_config.folder, ec.message());
+        m_config.enabled = false;
+        return;
+    }
+    spdlog::info("Engine::AssetCache using '{}'", m_config.folder);
+}
+
+auto engine::AssetCache::texture(const std::string_view path) const -> std::optional<Pixels>
+{
+    static auto holder = Core::Holder{};
+
+    const auto source = holder.instance->getFileSystem().read(path);
+    if (!source.has_value()) return {};
+
+    if (!m_config.enabled) return Pixels::decode(source->view());
+
+    const auto filename = entry(hash(source->view()), m_config.mipmaps ? "mips" : "rgba");
+    if (auto blob = MappedFile::open(filename); blob.has_value()) {
+        TextureHeader header{};
+        if (blob->size() >= sizeof(header)) std::memcpy(&header, blob->data(), sizeof(header));
+
+        if (std::memcmp(header.magic, kTextureMagic, sizeof(kTextureMagic)) == 0 && header.version == kVersion) {
+            auto out = Pixels::map(std::move(blob.value()), sizeof(header), header.width, header.height, header.levels);
+            if (out.has_value()) return out;
+        }
+        spdlog::warn("Engine::AssetCache '{}' is invalid and will be written again", filename);
+    }
+
+    auto out = Pixels::decode(source->view());
+    if (!out.has_value()) return {};
+    if (m_config.mipmaps) out->generateMipmaps();
+
+    TextureHeader header{
+        .magic = {},
+        .version = kVersion,
+        .width = out->width(),
+        .height = out->height(),
+        .levels = static_cast<std::uint32_t>(out->levels().size()),
+        .reserved = {},
+    };
+    std::memcpy(header.magic, kTextureMagic, sizeof(kTextureMagic));
+
+    std::vector<std::string_view> parts{{reinterpret_cast<const char *>(&header), sizeof(header)}};
+    for (const auto &level : out->levels()) {
+        parts.emplace_back(reinterpret_cast<const char *>(level.data), level.size());
+    }
+    write(filename, parts);
+
+    return out;
+}
+
+auto engine::AssetCache::spritesheet(const std::string_view path) const -> Spritesheet
+{
+    static auto holder = Core::Holder{};
+
+    if (!m_config.enabled) return Spritesheet::from_json(path);
+
+    // note : the entry is named after the json, the size of the images is checked by @deserialize
+    const auto source = holder.instance->getFileSystem().read(path);
+    if (!source.has_value()) return Spritesheet::from_json(path);
+
+    const auto filename = entry(hash(source->view()), "sheet");
+    if (const auto blob = MappedFile::open(filename); blob.has_value()) {
+        if (auto out = deserialize(blob->view()); out.has_value()) return std::move(out.value());
+        spdlog::warn("Engine::AssetCache '{}' is invalid or stale and will be written again", filename);
+    }
+
+    auto out = Spritesheet::from_json(path);
+    const auto content = serialize(out);
+    write(filename, {content});
+    return out;
+}
+
+auto engine::AssetCache::program(std::uint64_t key) const -> std::optional<ProgramBinary>
+{
+    if (!m_config.enabled) return {};
+
+    const auto filename = entry(key, "prog");
+    const auto blob = MappedFile::open(filename);
+    if (!blob.has_value()) return {};
+
+    Reader reader{.in = blob->view()};
+    const auto magic = reader.get<std::array<char, 4>>();
+    if (std::memcmp(magic.data(), kProgramMagic, sizeof(kProgramMagic)) == 0
+        && reader.get<std::uint32_t>() == kVersion) {
+        ProgramBinary out{.format = reader.get<std::uint32_t>(), .data = reader.string()};
+        if (reader.ok && reader.in.empty()) return out;
+    }
+    spdlog::warn("Engine::AssetCache '{}' is invalid and will be written again", filename);
+    return {};
+}
+
+auto engine::AssetCache::storeProgram(std::uint64_t key, const ProgramBinary &binary) const -> void
+{
+    if (!m_config.enabled) return;
+
+    Writer writer;
+    writer.put(kProgramMagic);
+    writer.put(kVersion);
+    writer.put(binary.format);
+    writer.put(std::string_view{binary.data});
+    write(entry(key, "prog"), {writer.out});
+}
+
+auto engine::AssetCache::hash(const std::string_view content) noexcept -> std::uint64_t
+{
+    auto out = 14695981039346656037ull;
+    for (const auto c : content) {
+        out ^= static_cast<std::uint8_t>(c);
+        out *= 1099511628211ull;
+    }
+    return out;
+}
+
+auto engine::AssetCache::entry(std::uint64_t key, const std::string_view extension) const -> std::string
+{
+    return fmt::format("{}{:016x}.{}", m_config.folder, key, extension);
+}
+
+auto engine::AssetCache::write(const std::string &path, const std::vector<std::string_view> &parts) -> void
+{
+    // note : two workers may write the same entry, the rename makes sure a reader never sees half of it
+    const auto temporary = fmt::format("{}.{}.tmp", path, std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream out{temporary, std::ios::binary | std::ios::trunc};
+        for (const auto &part : parts) out.write(part.data(), static_cast<std::streamsize>(part.size()));
+        if (!out.good()) {
+            spdlog::warn("Engine::AssetCache could not write '{}'", temporary);
+            out.close();
+            std::error_code ec;
+            std::filesystem::remove(temporary, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        spdlog::warn("Engine::AssetCache could not write '{}': {}", path, ec.message());
+        std::filesystem::remove(temporary, ec);
+    }
+}
@@ -0,0 +1,272 @@
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/helpers/overloaded.hpp"
+#include "Engine/resources/LoaderTexture.hpp"
+#include "Engine/resources/AssetLoader.hpp"
+#include "Engine/resources/AssetCache.hpp"
+#include "Engine/audio/AudioManager.hpp"
+#include "Engine/Settings.hpp"
+#include "Engine/Core.hpp"
+
+engine::AssetLoader::AssetLoader(const std::string &data_folder, std::size_t threads) : m_data_folder{data_folder}
+{
+    threads = std::max<std::size_t>(threads, 1);
+    spdlog::info("Engine::AssetLoader decoding the assets on {} threads", threads);
+
+    for (auto i = 0ul; i != threads; i++) {
+        m_workers.emplace_back([this] {
+            while (true) {
+                Job job;
+                {
+                    std::unique_lock lock{m_mutex};
+                    m_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                    if (m_stop) return;
+                    job = std::move(m_jobs.front());
+                    m_jobs.pop_front();
+                }
+
+                auto decoded = decode(job);
+
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_decoded.push_back(std::move(decoded));
+                }
+                m_cv.notify_all();
+            }
+        });
+    }
+}
+
+engine::AssetLoader::~AssetLoader()
+{
+    {
+        std::lock_guard lock{m_mutex};
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto &worker : m_workers) worker.join();
+}
+
+auto engine::AssetLoader::texture(const ResourceId &resource, bool mirrored_repeated) -> entt::resource_handle<Texture>
+{
+    static Core::Holder holder{};
+
+    auto &cache = holder.instance->getTextures();
+    const auto id = resource.with(mirrored_repeated);
+    if (cache.contains(id)) return cache.handle(id);
+
+    // note : released over the budget, a placeholder would show nothing for a few frames, it is loaded at once
+    if (const auto entry = m_residency.find(id); entry != nullptr) return reload(id, *entry);
+
+    // note : the full path is only built when the texture is not yet loaded
+    m_residency.track(id, ResourceId::intern(resource.path()), mirrored_repeated);
+    auto handle = cache.load<LoaderTexturePlaceholder>(id, mirrored_repeated);
+
+    m_requested.insert(id);
+    push(Job{.kind = Job::TEXTURE, .id = id, .path = m_data_folder + std::string{resource.path()}});
+
+    return handle;
+}
+
+auto engine::AssetLoader::use(entt::id_type id) -> std::uint32_t
+{
+    static Core::Holder holder{};
+
+    if (auto &cache = holder.instance->getTextures(); cache.contains(id)) return cache.handle(id)->id;
+
+    if (const auto entry = m_residency.find(id); entry != nullptr) return reload(id, *entry)->id;
+
+    return 0;
+}
+
+auto engine::AssetLoader::reload(entt::id_type id, const TextureResidency::Entry &entry)
+    -> entt::resource_handle<Texture>
+{
+    static Core::Holder holder{};
+
+    spdlog::debug("Engine::AssetLoader loading '{}' again", entry.resource.path());
+
+    // note : the pixels stored by its first load are mapped from the asset cache, nothing is decoded again
+    const auto start = std::chrono::steady_clock::now();
+    auto &cache = holder.instance->getTextures();
+    auto handle = cache.load<LoaderTexturePlaceholder>(id, entry.mirrored_repeated);
+    const auto path = m_data_folder + std::string{entry.resource.path()};
+    if (const auto pixels = holder.instance->getAssetCache().texture(path); pixels.has_value()) {
+        Texture::upload(handle.get(), pixels.value());
+        cache.resize(id, TextureResidency::estimate(handle.get()));
+    } else {
+        spdlog::error("Could not open texture '{}'. Texture will appear black", entry.resource.path());
+    }
+    cache.record(std::chrono::steady_clock::now() - start);
+
+    return handle;
+}
+
+auto engine::AssetLoader::sound(const ResourceId &resource) -> void
+{
+    static Core::Holder holder{};
+
+    if (m_requested.contains(resource.id()) || holder.instance->getAudioManager().contains(resource.id())) return;
+
+    ResourceId::intern(resource.path());
+
+    m_requested.insert(resource.id());
+    push(Job{.kind = Job::SOUND, .id = resource.id(), .path = m_data_folder + std::string{resource.path()}});
+}
+
+auto engine::AssetLoader::takeSound(const ResourceId &resource) -> std::optional<AudioFileBuffer::Pcm>
+{
+    if (!m_requested.contains(resource.id())) return {};
+
+    const auto is_requested = [&resource](const Decoded &decoded) {
+        const auto sound = std::get_if<DecodedSound>(&decoded);
+        return sound != nullptr && sound->id == resource.id();
+    };
+
+    std::unique_lock lock{m_mutex};
+    m_cv.wait(lock, [&] { return std::any_of(m_decoded.begin(), m_decoded.end(), is_requested); });
+
+    const auto found = std::find_if(m_decoded.begin(), m_decoded.end(), is_requested);
+    auto out = std::move(std::get<DecodedSound>(*found).pcm);
+    m_decoded.erase(found);
+    m_requested.erase(resource.id());
+
+    return out;
+}
+
+auto engine::AssetLoader::spritesheet(const ResourceId &resource) -> const Spritesheet &
+{
+    if (const auto found = m_spritesheets.find(resource.id()); found != m_spritesheets.end()) return found->second;
+
+    // note : not preloaded or not parsed yet, the spritesheet is parsed right away
+    static Core::Holder holder{};
+
+    auto out = holder.instance->getAssetCache().spritesheet(m_data_folder + std::string{resource.path()});
+    return m_spritesheets.emplace(resource.id(), std::move(out)).first->second;
+}
+
+auto engine::AssetLoader::preload(const Manifest &manifest) -> void
+{
+    for (const auto &i : manifest.textures) {
+        if (!i.empty()) texture(ResourceId::intern(i));
+    }
+
+    for (const auto &i : manifest.sounds) {
+        if (!i.empty()) sound(ResourceId::intern(i));
+    }
+
+    for (const auto &i : manifest.spritesheets) {
+        if (i.empty()) continue;
+
+        const auto resource = ResourceId::intern(i);
+        if (m_spritesheets.contains(resource.id()) || m_requested.contains(resource.id())) continue;
+
+        m_requested.insert(resource.id());
+        push(Job{.kind = Job::SPRITESHEET, .id = resource.id(), .path = m_data_folder + i});
+    }
+}
+
+auto engine::AssetLoader::update(std::chrono::microseconds budget) -> void
+{
+    static Core::Holder holder{};
+
+    const auto start = std::chrono::steady_clock::now();
+
+    m_residency.collect(holder.instance->getTextures());
+
+    // note : at least one upload per frame, so a small budget can not starve the loader
+    do {
+        Decoded next;
+        {
+            std::lock_guard lock{m_mutex};
+            if (m_decoded.empty()) return;
+            next = std::move(m_decoded.front());
+            m_decoded.pop_front();
+        }
+        apply(std::move(next));
+    } while (std::chrono::steady_clock::now() - start < budget);
+}
+
+auto engine::AssetLoader::push(Job &&job) -> void
+{
+    {
+        std::lock_guard lock{m_mutex};
+        m_jobs.push_back(std::move(job));
+    }
+    m_cv.notify_one();
+}
+
+auto engine::AssetLoader::decode(const Job &job) -> Decoded
+{
+    static Core::Holder holder{};
+
+    switch (job.kind) {
+    case Job::TEXTURE: {
+        const auto start = std::chrono::steady_clock::now();
+        DecodedTexture out{.id = job.id, .pixels = holder.instance->getAssetCache().texture(job.path), .elapsed = {}};
+        out.elapsed = std::chrono::steady_clock::now() - start;
+        if (!out.pixels.has_value()) {
+            spdlog::error("Could not open texture '{}'. Texture will appear black", job.path);
+        }
+        return out;
+    }
+    case Job::SOUND: {
+        DecodedSound out{.id = job.id, .pcm = std::nullopt};
+        try {
+            out.pcm = AudioFileBuffer::Pcm::decode(job.path);
+        } catch (const std::exception &e) {
+            spdlog::error("Engine::AssetLoader {}", e.what());
+        }
+        return out;
+    }
+    case Job::SPRITESHEET: {
+        ParsedSpritesheet out{.id = job.id, .spritesheet = std::nullopt};
+        try {
+            out.spritesheet = holder.instance->getAssetCache().spritesheet(job.path);
+        } catch (const std::exception &e) {
+            spdlog::error("Engine::AssetLoader could not parse the spritesheet '{}': {}", job.path, e.what());
+        }
+        return out;
+    }
+    default: std::abort();
+    }
+}
+
+auto engine::AssetLoader::apply(Decoded &&decoded) -> void
+{
+    static Core::Holder holder{};
+
+    std::visit(
+        overloaded{
+            [&](DecodedTexture &image) {
+                m_requested.erase(image.id);
+
+                // note : the cache may have been cleared in the meantime
+                auto &cache = holder.instance->getTextures();
+                if (!image.pixels.has_value() || !cache.contains(image.id)) return;
+
+                const auto start = std::chrono::steady_clock::now();
+                auto handle = cache.peek(image.id);
+                Texture::upload(handle.get(), image.pixels.value());
+                cache.resize(image.id, TextureResidency::estimate(handle.get()));
+                cache.record(image.elapsed + (std::chrono::steady_clock::now() - start));
+            },
+            [&](DecodedSound &sound) {
+                m_requested.erase(sound.id);
+                if (sound.pcm.has_value()) {
+                    holder.instance->getAudioManager().addSound(sound.id, sound.pcm.value());
+                }
+            },
+            [&](ParsedSpritesheet &parsed) {
+                m_requested.erase(parsed.id);
+                if (!parsed.spritesheet.has_value()) return;
+
+                // note : the textures of a preloaded spritesheet are likely to be used soon
+                for (const auto &animation : parsed.spritesheet->animations) texture(animation.texture);
+                m_spritesheets.emplace(parsed.id, std::move(parsed.spritesheet.value()));
+            },
+        },
+        decoded);
+}
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <tuple>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <entt/entt.hpp>
+
+#include "Engine/resources/AssetPack.hpp"
+
+namespace {
+
+constexpr auto align(std::uint64_t offset) noexcept -> std::uint64_t
+{
+    using engine::AssetPack;
+    return (offset + AssetPack::kAlignment - 1) / AssetPack::kAlignment * AssetPack::kAlignment;
+}
+
+auto pad(std::ofstream &out) -> std::uint64_t
+{
+    static constexpr char zeros[engine::AssetPack::kAlignment] = {};
+
+    const auto offset = static_cast<std::uint64_t>(out.tellp());
+    const auto aligned = align(offset);
+    out.write(zeros, static_cast<std::streamsize>(aligned - offset));
+    return aligned;
+}
+
+} // namespace
+
+engine::AssetPack::AssetPack(MappedFile &&file) :
+    m_file{std::move(file)},
+    m_header{reinterpret_cast<const Header *>(m_file.data())},
+    m_entries{reinterpret_cast<const Entry *>(m_file.data() + m_header->entries_offset)},
+    m_paths{m_file.data() + m_header->paths_offset}
+{
+}
+
+auto engine::AssetPack::open(const std::string_view path) -> std::optional<AssetPack>
+{
+    auto file = MappedFile::open(path);
+    if (!file.has_value()) return {};
+
+    const auto invalid = [&path](const std::string_view reason) -> std::optional<AssetPack> {
+        spdlog::error("Engine::AssetPack '{}' is not a valid pack: {}", path, reason);
+        return {};
+    };
+
+    if (file->size() < sizeof(Header)) return invalid("too small");
+
+    Header header;
+    std::memcpy(&header, file->data(), sizeof(Header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) return invalid("bad magic");
+    if (header.version != kVersion) return invalid(fmt::format("version {}, expected {}", header.version, kVersion));
+    // note : written as subtractions, the offsets of a corrupted pack would overflow a sum
+    if (header.entries_offset % kAlignment != 0 || header.paths_offset > file->size()
+        || header.entries_offset > header.paths_offset
+        || header.count > (header.paths_offset - header.entries_offset) / sizeof(Entry)) {
+        return invalid("truncated table of content");
+    }
+
+    // note : checked once here, so a lookup never reads outside of the mapping
+    const auto entries = reinterpret_cast<const Entry *>(file->data() + header.entries_offset);
+    const auto paths_size = file->size() - header.paths_offset;
+    for (auto i = 0u; i != header.count; i++) {
+        const auto &entry = entries[i];
+        if (entry.offset > header.entries_offset || entry.size > header.entries_offset - entry.offset
+            || std::uint64_t{entry.path_offset} + entry.path_size > paths_size
+            || (i != 0 && entries[i - 1].hash > entry.hash)) {
+            return invalid(fmt::format("corrupted entry {}", i));
+        }
+    }
+
+    spdlog::info("Engine::AssetPack '{}' mounted with {} files", path, header.count);
+    return AssetPack{std::move(file.value())};
+}
+
+auto engine::AssetPack::find(const std::string_view path) const -> std::optional<std::string_view>
+{
+    const auto hash = entt::hashed_string::value(path.data(), path.size());
+
+    const auto end = m_entries + m_header->count;
+    for (auto it = std::lower_bound(
+             m_entries, end, hash, [](const Entry &entry, std::uint32_t value) { return entry.hash < value; });
+         it != end && it->hash == hash;
+         ++it) {
+        if (std::string_view{m_paths + it->path_offset, it->path_size} == path) {
+            return std::string_view{m_file.data() + it->offset, static_cast<std::size_t>(it->size)};
+        }
+    }
+    return {};
+}
+
+auto engine::AssetPack::build(const std::string &folder, const std::string &output) -> bool
+{
+    struct Source {
+        std::filesystem::path file;
+        std::string path;
+        std::uint32_t hash;
+    };
+
+    std::error_code ec;
+    std::vector<Source> sources;
+    const auto self = std::filesystem::absolute(output);
+    for (const auto &it : std::filesystem::recursive_directory_iterator{folder, ec}) {
+        if (!it.is_regular_file() || std::filesystem::absolute(it.path()) == self) continue;
+        auto path = std::filesystem::relative(it.path(), folder).generic_string();
+        const auto hash = entt::hashed_string::value(path.data(), path.size());
+        sources.push_back({it.path(), std::move(path), hash});
+    }
+    if (ec) {
+        spdlog::error("Engine::AssetPack could not list '{}': {}", folder, ec.message());
+        return false;
+    }
+
+    std::sort(sources.begin(), sources.end(), [](const auto &lhs, const auto &rhs) {
+        return std::tie(lhs.hash, lhs.path) < std::tie(rhs.hash, rhs.path);
+    });
+    for (auto i = 1ul; i < sources.size(); i++) {
+        if (sources[i - 1].hash == sources[i].hash) {
+            // note : still readable, but the resources are identified by this hash (see @ResourceId)
+            spdlog::warn(
+                "Engine::AssetPack hash collision between '{}' and '{}'", sources[i - 1].path, sources[i].path);
+        }
+    }
+
+    std::ofstream out{output, std::ios::binary | std::ios::trunc};
+    if (!out) {
+        spdlog::error("Engine::AssetPack could not create '{}'", output);
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.count = static_cast<std::uint32_t>(sources.size());
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    std::vector<Entry> entries;
+    std::string paths;
+    entries.reserve(sources.size());
+    for (const auto &source : sources) {
+        Entry entry{
+            .hash = source.hash,
+            .path_offset = static_cast<std::uint32_t>(paths.size()),
+            .path_size = static_cast<std::uint32_t>(source.path.size()),
+            .reserved = 0,
+            .offset = pad(out),
+            .size = 0,
+        };
+        paths += source.path;
+
+        std::ifstream in{source.file, std::ios::binary};
+        if (!in) {
+            spdlog::error("Engine::AssetPack could not read '{}'", source.file.string());
+            return false;
+        }
+        // note : inserting an empty buffer would set the failbit
+        if (std::filesystem::file_size(source.file) != 0) out << in.rdbuf();
+        entry.size = static_cast<std::uint64_t>(out.tellp()) - entry.offset;
+        entries.push_back(entry);
+    }
+
+    header.entries_offset = pad(out);
+    out.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+    header.paths_offset = static_cast<std::uint64_t>(out.tellp());
+    out.write(paths.data(), static_cast<std::streamsize>(paths.size()));
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    if (!out.good()) {
+        spdlog::error("Engine::AssetPack could not write '{}'", output);
+        return false;
+    }
+    spdlog::info("Engine::AssetPack '{}' written with {} files", output, sources.size());
+    return true;
+}
@@ -0,0 +1,33 @@
+#include <spdlog/spdlog.h>
+
+#include "Engine/resources/FileSystem.hpp"
+
+engine::FileSystem::FileSystem(const std::string &data_folder) : m_data_folder{data_folder} {}
+
+auto engine::FileSystem::mount(const std::string_view pack) -> bool
+{
+    m_pack = AssetPack::open(pack);
+    if (!m_pack.has_value()) {
+        spdlog::info("Engine::FileSystem no asset pack at '{}', reading the files of '{}'", pack, m_data_folder);
+    }
+    return isMounted();
+}
+
+auto engine::FileSystem::read(const std::string_view path) const -> std::optional<File>
+{
+    const auto relative = path.starts_with(m_data_folder) ? path.substr(m_data_folder.size()) : path;
+
+    File out;
+    if (m_pack.has_value()) {
+        if (const auto found = m_pack->find(relative); found.has_value()) {
+            out.m_view = found.value();
+            return out;
+        }
+        spdlog::debug("Engine::FileSystem '{}' is not in the asset pack", relative);
+    }
+
+    out.m_mapping = MappedFile::open(m_data_folder + std::string{relative});
+    if (!out.m_mapping.has_value()) return {};
+    out.m_view = out.m_mapping->view();
+    return out;
+}
@@ -0,0 +1,102 @@
+#include <utility>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/resources/MappedFile.hpp"
+
+auto engine::MappedFile::open(const std::string_view path) -> std::optional<MappedFile>
+{
+    const std::string filename{path};
+    MappedFile out;
+
+#ifdef _WIN32
+    const auto file = ::CreateFileA(
+        filename.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return {};
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size)) {
+        ::CloseHandle(file);
+        return {};
+    }
+    out.m_size = static_cast<std::size_t>(size.QuadPart);
+
+    if (out.m_size != 0) {
+        // note : the view keeps the mapping alive, both handles can be closed right away
+        const auto mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            out.m_data = static_cast<const char *>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            ::CloseHandle(mapping);
+        }
+    }
+    ::CloseHandle(file);
+#else
+    const auto fd = ::open(filename.data(), O_RDONLY);
+    if (fd == -1) return {};
+
+    struct stat info;
+    if (::fstat(fd, &info) == -1) {
+        ::close(fd);
+        return {};
+    }
+    out.m_size = static_cast<std::size_t>(info.st_size);
+
+    if (out.m_size != 0) {
+        // note : the mapping stays valid once the descriptor is closed
+        if (const auto data = ::mmap(nullptr, out.m_size, PROT_READ, MAP_PRIVATE, fd, 0); data != MAP_FAILED) {
+            out.m_data = static_cast<const char *>(data);
+        }
+    }
+    ::close(fd);
+#endif
+
+    if (out.m_size == 0) {
+        out.m_data = "";
+    } else if (out.m_data == nullptr) {
+        spdlog::error("Engine::MappedFile could not map '{}'", path);
+        out.m_size = 0;
+        return {};
+    }
+
+    return out;
+}
+
+engine::MappedFile::~MappedFile() { release(); }
+
+engine::MappedFile::MappedFile(MappedFile &&other) noexcept :
+    m_data{std::exchange(other.m_data, nullptr)}, m_size{std::exchange(other.m_size, 0)}
+{
+}
+
+auto engine::MappedFile::operator=(MappedFile &&other) noexcept -> MappedFile &
+{
+    if (this != &other) {
+        release();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+auto engine::MappedFile::release() noexcept -> void
+{
+    // note : an empty file is not mapped
+    if (m_data == nullptr || m_size == 0) return;
+
+#ifdef _WIN32
+    ::UnmapViewOfFile(m_data);
+#else
+    ::munmap(const_cast<char *>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
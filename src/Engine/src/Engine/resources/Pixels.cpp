@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstring>
+
+#include <spdlog/spdlog.h>
+#include <stb_image.h>
+
+#include "Engine/resources/Pixels.hpp"
+
+auto engine::Pixels::decode(const std::string_view content) -> std::optional<Pixels>
+{
+    std::int32_t width = 0;
+    std::int32_t height = 0;
+    std::int32_t channels = 0;
+    const auto px = ::stbi_load_from_memory(
+        reinterpret_cast<const stbi_uc *>(content.data()),
+        static_cast<int>(content.size()),
+        &width,
+        &height,
+        &channels,
+        CHANNEL);
+    if (px == nullptr) return {};
+
+    Pixels out;
+    const Level level{.width = width, .height = height, .data = nullptr};
+    // note : room for the mipmaps, a chain is a third of the first level
+    out.m_storage.reserve(level.size() + level.size() / 3 + CHANNEL * 32);
+    out.m_storage.assign(px, px + level.size());
+    ::stbi_image_free(px);
+
+    out.m_levels.push_back(level);
+    out.m_levels.back().data = out.m_storage.data();
+    return out;
+}
+
+auto engine::Pixels::map(MappedFile &&file, std::size_t offset, std::int32_t width, std::int32_t height, std::size_t levels)
+    -> std::optional<Pixels>
+{
+    Pixels out;
+    for (auto i = 0ul; i != levels; i++) {
+        const Level level{.width = width, .height = height, .data = nullptr};
+        if (width <= 0 || height <= 0 || offset + level.size() > file.size()) return {};
+
+        out.m_levels.push_back(level);
+        out.m_levels.back().data = reinterpret_cast<const std::uint8_t *>(file.data() + offset);
+        offset += level.size();
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    if (out.m_levels.empty()) return {};
+
+    out.m_mapping = std::move(file);
+    return out;
+}
+
+auto engine::Pixels::generateMipmaps() -> void
+{
+    if (m_mapping.has_value() || m_levels.empty()) return;
+
+    m_levels.resize(1);
+    auto total = m_levels.front().size();
+    for (auto level = m_levels.front(); level.width != 1 || level.height != 1;) {
+        level.width = std::max(level.width / 2, 1);
+        level.height = std::max(level.height / 2, 1);
+        m_levels.push_back(level);
+        total += level.size();
+    }
+
+    // note : the storage may move, the pointers are given once it has its final size
+    m_storage.resize(total);
+    auto offset = 0ul;
+    for (auto &level : m_levels) {
+        level.data = m_storage.data() + offset;
+        offset += level.size();
+    }
+
+    for (auto i = 1ul; i < m_levels.size(); i++) {
+        const auto &src = m_levels[i - 1];
+        const auto &dst = m_levels[i];
+        auto out = m_storage.data() + (dst.data - m_storage.data());
+
+        const auto texel = [&src](std::int32_t x, std::int32_t y) {
+            x = std::min(x, src.width - 1);
+            y = std::min(y, src.height - 1);
+            const auto index = static_cast<std::size_t>(y * src.width + x);
+            return src.data + index * CHANNEL;
+        };
+
+        for (auto y = 0; y != dst.height; y++) {
+            for (auto x = 0; x != dst.width; x++) {
+                const auto a = texel(2 * x, 2 * y);
+                const auto b = texel(2 * x + 1, 2 * y);
+                const auto c = texel(2 * x, 2 * y + 1);
+                const auto d = texel(2 * x + 1, 2 * y + 1);
+                for (auto channel = 0ul; channel != CHANNEL; channel++) {
+                    *out++ = static_cast<std::uint8_t>((a[channel] + b[channel] + c[channel] + d[channel] + 2) / 4);
+                }
+            }
+        }
+    }
+}
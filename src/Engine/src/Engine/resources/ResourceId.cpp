@@ -0,0 +1,51 @@
+#include <mutex>
+#include <unordered_map>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/resources/ResourceId.hpp"
+
+namespace {
+
+struct InternTable {
+    std::mutex mutex;
+    // note : the nodes of an unordered_map never move, the views on the strings stay valid
+    std::unordered_map<entt::id_type, std::string> names;
+};
+
+auto table() -> InternTable &
+{
+    static InternTable instance;
+    return instance;
+}
+
+} // namespace
+
+auto engine::ResourceId::intern(const std::string_view path) -> ResourceId
+{
+    const auto id = entt::hashed_string::value(path.data(), path.size());
+
+    auto &t = table();
+    std::lock_guard lock{t.mutex};
+
+    auto it = t.names.find(id);
+    if (it == t.names.end()) {
+        it = t.names.emplace(id, std::string{path}).first;
+    } else if (it->second != path) {
+        spdlog::warn("resource identifier collision between '{}' and '{}'", it->second, path);
+    }
+
+    ResourceId out;
+    out.m_id = id;
+    out.m_path = it->second;
+    return out;
+}
+
+auto engine::ResourceId::name(entt::id_type id) -> std::string_view
+{
+    auto &t = table();
+    std::lock_guard lock{t.mutex};
+
+    if (const auto it = t.names.find(id); it != t.names.end()) return it->second;
+    return "<unknown>";
+}
@@ -0,0 +1,30 @@
+#include <spdlog/spdlog.h>
+
+#include "Engine/resources/TextureResidency.hpp"
+
+auto engine::TextureResidency::track(entt::id_type id, const ResourceId &resource, bool mirrored_repeated) -> void
+{
+    m_entries.try_emplace(id, Entry{.resource = resource, .mirrored_repeated = mirrored_repeated});
+}
+
+auto engine::TextureResidency::find(entt::id_type id) const noexcept -> const Entry *
+{
+    const auto found = m_entries.find(id);
+    return found == m_entries.end() ? nullptr : &found->second;
+}
+
+auto engine::TextureResidency::collect(CacheTexture &cache) -> void
+{
+    m_frame++;
+
+    while (!m_released.empty() && m_released.front().first + FRAMES_IN_FLIGHT <= m_frame) m_released.pop_front();
+
+    for (auto &handle : cache.trim()) m_released.emplace_back(m_frame, std::move(handle));
+}
+
+auto engine::TextureResidency::estimate(const Texture &texture) noexcept -> std::size_t
+{
+    const auto level = static_cast<std::size_t>(texture.width) * static_cast<std::size_t>(texture.height) * 4;
+    // note : a full chain of mipmaps is a third of the first level
+    return level + level / 3;
+}
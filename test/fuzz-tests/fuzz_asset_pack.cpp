@@ -0,0 +1,38 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/resources/AssetPack.hpp"
+
+// note : a pack is only opened from a file, the input is written to a temporary one
+// cppcheck-suppress unusedFunction symbolName=LLVMFuzzerTestOneInput
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+    static const auto path = [] {
+        spdlog::set_level(spdlog::level::off);
+        return (std::filesystem::temp_directory_path() / "fuzz_asset_pack.pack").string();
+    }();
+
+    {
+        std::ofstream out{path, std::ios::binary | std::ios::trunc};
+        out.write(reinterpret_cast<const char *>(Data), static_cast<std::streamsize>(Size));
+    }
+
+    const auto pack = engine::AssetPack::open(path);
+    if (!pack.has_value()) return 0;
+
+    // note : once the pack is accepted, a lookup must only read inside of the mapping
+    for (const auto *name : {"", "textures/player.png", "sounds/hit.wav"}) {
+        const auto file = pack->find(name);
+        if (!file.has_value() || file->empty()) continue;
+
+        volatile char first = file->front();
+        volatile char last = file->back();
+        static_cast<void>(first);
+        static_cast<void>(last);
+    }
+    return 0;
+}
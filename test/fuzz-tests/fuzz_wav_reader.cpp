@@ -0,0 +1,30 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+#include <spdlog/spdlog.h>
+
+#include "Engine/audio/WavReader.hpp"
+
+// cppcheck-suppress unusedFunction symbolName=LLVMFuzzerTestOneInput
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+    [[maybe_unused]] static const auto quiet = [] {
+        spdlog::set_level(spdlog::level::off);
+        return true;
+    }();
+
+    const std::string_view content{reinterpret_cast<const char *>(Data), Size};
+    const auto wav = engine::load_wav(content);
+    if (!wav.has_value()) return 0;
+
+    // note : the samples are a view on whole frames inside of the input
+    const auto frame = static_cast<std::size_t>(wav->channels) * ((wav->bits_per_sample + 7u) / 8u);
+    if (frame == 0 || wav->samples.size() % frame != 0) std::abort();
+    if (!wav->samples.empty()
+        && (wav->samples.data() < content.data()
+            || wav->samples.data() + wav->samples.size() > content.data() + content.size())) {
+        std::abort();
+    }
+    return 0;
+}
@@ -1,9 +1,15 @@
 #!/usr/bin/env python3
 
+import glob
 import subprocess
+import shutil
 import sys
 import os
 
+# note : GOLDEN_CAPTURE_EVERY=N records one frame every N frames of the replay in results/capture/
+capture_every = os.environ.get('GOLDEN_CAPTURE_EVERY', '0')
+capture_format = os.environ.get('GOLDEN_CAPTURE_FORMAT', 'png')
+
 resolutions = [
 #    [1280, 1024],
 #    [1600, 1200],
@@ -11,16 +17,28 @@ resolutions = [
     [1920, 1080]
 ]
 
+here = os.path.dirname(os.path.realpath(__file__))
+failed = False
+
 for row in resolutions:
     x, y = row
     args = [
-        '--replay-path', os.path.dirname(os.path.realpath(__file__)) + '/take-screenshot.json',
+        '--replay-path', here + '/take-screenshot.json',
         '--window-width', str(x),
         '--window-height', str(y),
-        '--output-folder', os.path.dirname(os.path.realpath(__file__)) + '/results/',
-        '--fullscreen', 'true'
+        '--output-folder', here + '/results/',
+        '--fullscreen', 'true',
+        '--capture-every', capture_every,
+        '--capture-format', capture_format
     ]
+    # note : the replay presses F12 on its last frame, the screenshot must still be written before the exit
+    shutil.rmtree(here + '/results/screenshot', ignore_errors=True)
     subprocess.call(['echo'] + args)
-    subprocess.call(['./tools/launch.sh', '--'] + args, cwd=os.path.dirname(os.path.realpath(__file__)) + '/../../')
+    subprocess.call(['./tools/launch.sh', '--'] + args, cwd=here + '/../../')
+    if not glob.glob(here + '/results/screenshot/*.png'):
+        print('no screenshot written for {}x{}'.format(x, y), file=sys.stderr)
+        failed = True
+
+subprocess.call(['rm', '-vrf', './results/logs'], cwd=here)
 
-subprocess.call(['rm', '-vrf', './results/logs'], cwd=os.path.dirname(os.path.realpath(__file__)))
+sys.exit(1 if failed else 0)
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "Engine/resources/AssetPack.hpp"
+
+namespace {
+
+auto write(const std::filesystem::path &path, const std::string &content) -> void
+{
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    out.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+} // namespace
+
+TEST_CASE("AssetPack reads back every file packed by engine_pack", "[AssetPack]")
+{
+    const auto root = std::filesystem::temp_directory_path() / "engine_unit_tests_asset_pack";
+    std::filesystem::remove_all(root);
+
+    const std::map<std::string, std::string> files{
+        {"empty.txt", ""},
+        {"config.json", R"({"width": 1920})"},
+        {"sounds/hit.wav", std::string{"RIFF\0\0\0\0WAVE", 12}},
+        {"textures/ui/a very long name.png", std::string(1000, 'x')},
+    };
+    for (const auto &[path, content] : files) write(root / "data" / path, content);
+
+    const auto output = (root / "data.pack").string();
+    const auto command =
+        fmt::format("\"{}\" --data \"{}\" --output \"{}\"", ENGINE_PACK, (root / "data").string(), output);
+    REQUIRE(std::system(command.c_str()) == 0);
+
+    const auto pack = engine::AssetPack::open(output);
+    REQUIRE(pack.has_value());
+    REQUIRE(pack->size() == files.size());
+
+    for (const auto &[path, content] : files) {
+        const auto file = pack->find(path);
+        REQUIRE(file.has_value());
+        CHECK(file.value() == content);
+        CHECK(reinterpret_cast<std::uintptr_t>(file->data()) % engine::AssetPack::kAlignment == 0);
+    }
+    CHECK_FALSE(pack->find("missing.txt").has_value());
+    CHECK_FALSE(pack->find("sounds").has_value());
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("AssetPack refuses a file that is not a pack", "[AssetPack]")
+{
+    const auto root = std::filesystem::temp_directory_path() / "engine_unit_tests_asset_pack_invalid";
+    std::filesystem::remove_all(root);
+
+    CHECK_FALSE(engine::AssetPack::open((root / "missing.pack").string()).has_value());
+
+    write(root / "small.pack", "PACK");
+    CHECK_FALSE(engine::AssetPack::open((root / "small.pack").string()).has_value());
+
+    write(root / "magic.pack", std::string(128, '\0'));
+    CHECK_FALSE(engine::AssetPack::open((root / "magic.pack").string()).has_value());
+
+    // note : a table of content whose end overflows back inside of the file
+    engine::AssetPack::Header header{};
+    std::memcpy(header.magic, engine::AssetPack::kMagic, sizeof(header.magic));
+    header.version = engine::AssetPack::kVersion;
+    header.count = 2;
+    header.entries_offset = ~std::uint64_t{0} - engine::AssetPack::kAlignment + 1;
+    header.paths_offset = sizeof(header);
+    write(root / "truncated.pack", std::string{reinterpret_cast<const char *>(&header), sizeof(header)});
+    CHECK_FALSE(engine::AssetPack::open((root / "truncated.pack").string()).has_value());
+
+    std::filesystem::remove_all(root);
+}
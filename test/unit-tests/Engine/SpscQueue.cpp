@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+
+#include <thread>
+
+#include "Engine/helpers/SpscQueue.hpp"
+
+TEST_CASE("SpscQueue is empty before the first push and after the last pop", "[SpscQueue]")
+{
+    engine::SpscQueue<int, 4> queue;
+    REQUIRE_FALSE(queue.pop().has_value());
+
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.pop() == 1);
+    REQUIRE_FALSE(queue.pop().has_value());
+}
+
+TEST_CASE("SpscQueue refuses a push when full", "[SpscQueue]")
+{
+    engine::SpscQueue<int, 4> queue;
+    for (auto i = 0; i != 4; i++) REQUIRE(queue.push(int{i}));
+    REQUIRE_FALSE(queue.push(4));
+
+    // note : a single pop makes room for a single push
+    REQUIRE(queue.pop() == 0);
+    REQUIRE(queue.push(4));
+    REQUIRE_FALSE(queue.push(5));
+
+    for (auto i = 1; i != 5; i++) REQUIRE(queue.pop() == i);
+    REQUIRE_FALSE(queue.pop().has_value());
+}
+
+TEST_CASE("SpscQueue keeps the order across the wrap-around of the ring", "[SpscQueue]")
+{
+    engine::SpscQueue<int, 4> queue;
+
+    // note : 3 values at a time never line up with the 4 slots, every slot is used at every offset
+    auto next = 0;
+    for (auto round = 0; round != 10; round++) {
+        for (auto i = 0; i != 3; i++) REQUIRE(queue.push(next + i));
+        for (auto i = 0; i != 3; i++) REQUIRE(queue.pop() == next + i);
+        next += 3;
+    }
+    REQUIRE_FALSE(queue.pop().has_value());
+}
+
+TEST_CASE("SpscQueue hands every value over from a producer thread to a consumer thread", "[SpscQueue]")
+{
+    constexpr auto count = 1'000'000;
+    engine::SpscQueue<int, 64> queue;
+
+    // note : the ring is much smaller than the values, the producer finds it full and the consumer finds it empty
+    std::thread producer{[&queue] {
+        for (auto i = 0; i != count; i++) {
+            while (!queue.push(int{i})) std::this_thread::yield();
+        }
+    }};
+
+    auto expected = 0;
+    auto ordered = true;
+    std::thread consumer{[&] {
+        while (expected != count) {
+            const auto value = queue.pop();
+            if (!value.has_value()) {
+                std::this_thread::yield();
+                continue;
+            }
+            ordered = ordered && value.value() == expected;
+            expected++;
+        }
+    }};
+
+    producer.join();
+    consumer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(expected == count);
+    REQUIRE_FALSE(queue.pop().has_value());
+}
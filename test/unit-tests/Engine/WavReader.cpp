@@ -0,0 +1,98 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Engine/audio/WavReader.hpp"
+
+namespace {
+
+auto le(std::uint32_t value, std::size_t bytes) -> std::string
+{
+    std::string out;
+    for (auto i = 0ul; i != bytes; i++) out += static_cast<char>((value >> (8 * i)) & 0xFF);
+    return out;
+}
+
+auto chunk(std::string_view id, const std::string &payload) -> std::string
+{
+    auto out = std::string{id} + le(static_cast<std::uint32_t>(payload.size()), 4) + payload;
+    if (payload.size() % 2 != 0) out += '\0';
+    return out;
+}
+
+auto format(std::uint16_t encoding, std::uint16_t channels, std::uint32_t rate, std::uint16_t bits) -> std::string
+{
+    const auto align = channels * ((bits + 7u) / 8u);
+    return le(encoding, 2) + le(channels, 2) + le(rate, 4) + le(rate * align, 4) + le(align, 2) + le(bits, 2);
+}
+
+auto riff(const std::string &chunks) -> std::string
+{
+    return "RIFF" + le(static_cast<std::uint32_t>(4 + chunks.size()), 4) + "WAVE" + chunks;
+}
+
+} // namespace
+
+TEST_CASE("load_wav reads the format and the samples of a PCM file", "[WavReader]")
+{
+    const std::string samples{"\x01\x00\x02\x00\x03\x00\x04\x00", 8};
+    const auto file = riff(chunk("fmt ", format(1, 2, 44100, 16)) + chunk("data", samples));
+
+    const auto wav = engine::load_wav(file);
+    REQUIRE(wav.has_value());
+    CHECK(wav->channels == 2);
+    CHECK(wav->sample_rate == 44100);
+    CHECK(wav->bits_per_sample == 16);
+    CHECK(wav->samples == samples);
+}
+
+TEST_CASE("load_wav skips the other chunks and their padding byte", "[WavReader]")
+{
+    const std::string samples{"\x80\x81\x82", 3};
+    const auto file =
+        riff(chunk("LIST", "odd") + chunk("fmt ", format(1, 1, 8000, 8)) + chunk("junk", "") + chunk("data", samples));
+
+    const auto wav = engine::load_wav(file);
+    REQUIRE(wav.has_value());
+    CHECK(wav->samples == samples);
+}
+
+TEST_CASE("load_wav reads the PCM sub format of an extensible file", "[WavReader]")
+{
+    // note : cbSize, valid bits, channel mask, then the guid starting with the encoding
+    const auto extension = le(22, 2) + le(16, 2) + le(3, 4) + le(1, 2) + std::string(14, '\0');
+    const auto file =
+        riff(chunk("fmt ", format(0xFFFE, 2, 48000, 16) + extension) + chunk("data", std::string(8, '\0')));
+
+    const auto wav = engine::load_wav(file);
+    REQUIRE(wav.has_value());
+    CHECK(wav->channels == 2);
+    CHECK(wav->samples.size() == 8);
+}
+
+TEST_CASE("load_wav keeps only the whole frames of a truncated file", "[WavReader]")
+{
+    // note : the data chunk announces 8 bytes, 7 are in the file
+    auto file = riff(chunk("fmt ", format(1, 2, 44100, 16)) + chunk("data", std::string(8, '\0')));
+    file.pop_back();
+
+    const auto wav = engine::load_wav(file);
+    REQUIRE(wav.has_value());
+    CHECK(wav->samples.size() == 4);
+}
+
+TEST_CASE("load_wav refuses the malformed files", "[WavReader]")
+{
+    const auto data = chunk("data", std::string(4, '\0'));
+
+    CHECK_FALSE(engine::load_wav("").has_value());
+    CHECK_FALSE(engine::load_wav(std::string_view{"RIFF\0\0\0\0AVI ", 12}).has_value());
+    CHECK_FALSE(engine::load_wav(riff(data)).has_value());
+    CHECK_FALSE(engine::load_wav(riff(chunk("fmt ", format(1, 2, 44100, 16)))).has_value());
+    CHECK_FALSE(engine::load_wav(riff(chunk("fmt ", "short") + data)).has_value());
+    CHECK_FALSE(engine::load_wav(riff(chunk("fmt ", format(3, 1, 44100, 32)) + data)).has_value());
+    CHECK_FALSE(engine::load_wav(riff(chunk("fmt ", format(1, 0, 44100, 16)) + data)).has_value());
+    CHECK_FALSE(engine::load_wav(riff(chunk("fmt ", format(1, 1, 44100, 0)) + data)).has_value());
+}